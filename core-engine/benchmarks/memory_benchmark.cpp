@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include "surveillance/memory_pool.hpp"
+#include "surveillance/trade_pattern_detector.hpp"
+
+using namespace dharmaguard::surveillance;
+
+namespace {
+
+// Single-threaded allocate/deallocate round trip - the thread-cache
+// fast path with no arena traffic
+void BM_MemoryPool_AllocDealloc(benchmark::State& state) {
+    MemoryPool<TradeRecord> pool(1 << 20);
+
+    for (auto _ : state) {
+        TradeRecord* record = pool.allocate();
+        benchmark::DoNotOptimize(record);
+        pool.deallocate(record);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MemoryPool_AllocDealloc);
+
+// Contended allocate/deallocate across threads; exercises the batched
+// refill/return path against the central arena
+void BM_MemoryPool_Contended(benchmark::State& state) {
+    static MemoryPool<TradeRecord>* pool = nullptr;
+    if (state.thread_index() == 0) {
+        pool = new MemoryPool<TradeRecord>(1 << 20);
+    }
+
+    for (auto _ : state) {
+        TradeRecord* record = pool->allocate();
+        benchmark::DoNotOptimize(record);
+        pool->deallocate(record);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        delete pool;
+        pool = nullptr;
+    }
+}
+BENCHMARK(BM_MemoryPool_Contended)->ThreadRange(1, 32)->UseRealTime();
+
+// Burst pattern: drain a full thread-cache batch and return it, forcing
+// arena interaction every iteration
+void BM_MemoryPool_BatchCycle(benchmark::State& state) {
+    MemoryPool<TradeRecord> pool(1 << 20);
+    std::vector<TradeRecord*> held;
+    held.reserve(2 * MemoryPool<TradeRecord>::kCacheBatch);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < 2 * MemoryPool<TradeRecord>::kCacheBatch; ++i) {
+            held.push_back(pool.allocate());
+        }
+        for (TradeRecord* record : held) {
+            pool.deallocate(record);
+        }
+        held.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2 * MemoryPool<TradeRecord>::kCacheBatch);
+}
+BENCHMARK(BM_MemoryPool_BatchCycle);
+
+} // namespace
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <boost/lockfree/queue.hpp>
+
+#include "surveillance/trade_pattern_detector.hpp"
+
+using namespace dharmaguard::surveillance;
+
+namespace {
+
+// Uncontended push/pop round trip on the per-shard queue type
+void BM_Queue_PushPop(benchmark::State& state) {
+    boost::lockfree::queue<TradeRecord*> queue(1 << 16);
+    TradeRecord record{};
+
+    for (auto _ : state) {
+        queue.push(&record);
+        TradeRecord* popped = nullptr;
+        queue.pop(popped);
+        benchmark::DoNotOptimize(popped);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Queue_PushPop);
+
+// SPSC-style throughput: producer thread 0, consumer thread 1 - the
+// shape each sharded worker queue sees in production
+void BM_Queue_ProducerConsumer(benchmark::State& state) {
+    static boost::lockfree::queue<TradeRecord*>* queue = nullptr;
+    static TradeRecord record{};
+    if (state.thread_index() == 0) {
+        queue = new boost::lockfree::queue<TradeRecord*>(1 << 16);
+    }
+
+    for (auto _ : state) {
+        if (state.thread_index() % 2 == 0) {
+            while (!queue->push(&record)) {
+                benchmark::DoNotOptimize(queue);
+            }
+        } else {
+            TradeRecord* popped = nullptr;
+            while (!queue->pop(popped)) {
+                benchmark::DoNotOptimize(queue);
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        TradeRecord* drain = nullptr;
+        while (queue->pop(drain)) {
+        }
+        delete queue;
+        queue = nullptr;
+    }
+}
+BENCHMARK(BM_Queue_ProducerConsumer)->Threads(2)->UseRealTime();
+
+// Batched drain as done by worker_thread_func(): pop up to 256 per wake
+void BM_Queue_BatchDrain(benchmark::State& state) {
+    boost::lockfree::queue<TradeRecord*> queue(1 << 16);
+    TradeRecord record{};
+    constexpr size_t kBatch = 256;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            queue.push(&record);
+        }
+        size_t drained = 0;
+        TradeRecord* popped = nullptr;
+        while (drained < kBatch && queue.pop(popped)) {
+            ++drained;
+        }
+        benchmark::DoNotOptimize(drained);
+    }
+
+    state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK(BM_Queue_BatchDrain);
+
+} // namespace
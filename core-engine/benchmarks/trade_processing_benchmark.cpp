@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include "surveillance/trade_pattern_detector.hpp"
+
+using namespace dharmaguard::surveillance;
+
+namespace {
+
+TradeData make_synthetic_trade(uint64_t sequence) {
+    TradeData trade;
+    trade.trade_id = "T" + std::to_string(sequence);
+    trade.instrument_symbol = "SYM" + std::to_string(sequence % 500);
+    trade.account_id = "ACC" + std::to_string(sequence % 2000);
+    trade.client_id = "CLI" + std::to_string(sequence % 2000);
+    trade.exchange = "NSE";
+    trade.order_id = "O" + std::to_string(sequence);
+    trade.trader_id = "TRD" + std::to_string(sequence % 100);
+    trade.trade_type = TradeData::TradeType::BUY;
+    trade.segment = TradeData::MarketSegment::EQUITY;
+    trade.quantity = 100 + sequence % 900;
+    trade.price = 100.0 + static_cast<double>(sequence % 1000) / 100.0;
+    trade.value = trade.price * static_cast<double>(trade.quantity);
+    trade.timestamp = std::chrono::system_clock::now();
+    trade.is_own_account = false;
+    trade.brokerage = 0.05;
+    trade.taxes = 0.02;
+    return trade;
+}
+
+// End-to-end single-trade submission: validation, interning, pool
+// allocation and shard routing (detection happens on the workers)
+void BM_ProcessTrade(benchmark::State& state) {
+    TradePatternDetector detector(4, 1 << 20);
+    detector.start();
+
+    uint64_t sequence = 0;
+    for (auto _ : state) {
+        auto trade = make_synthetic_trade(sequence++);
+        benchmark::DoNotOptimize(detector.process_trade(trade));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    detector.stop();
+}
+BENCHMARK(BM_ProcessTrade);
+
+// Batch submission at varying batch sizes
+void BM_ProcessTradesBatch(benchmark::State& state) {
+    TradePatternDetector detector(4, 1 << 20);
+    detector.start();
+
+    std::vector<TradeData> batch;
+    batch.reserve(static_cast<size_t>(state.range(0)));
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        batch.push_back(make_synthetic_trade(static_cast<uint64_t>(i)));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(detector.process_trades_batch(batch));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    detector.stop();
+}
+BENCHMARK(BM_ProcessTradesBatch)->Range(8, 8192);
+
+// POD record batch path used by the binary Kafka ingest
+void BM_ProcessRecordsBatch(benchmark::State& state) {
+    TradePatternDetector detector(4, 1 << 20);
+    detector.start();
+
+    std::vector<TradeRecord> records(static_cast<size_t>(state.range(0)));
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        make_trade_record(make_synthetic_trade(static_cast<uint64_t>(i)),
+                          records[static_cast<size_t>(i)]);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            detector.process_records_batch(records.data(), records.size()));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    detector.stop();
+}
+BENCHMARK(BM_ProcessRecordsBatch)->Range(8, 8192);
+
+// TradeData -> TradeRecord conversion cost in isolation
+void BM_MakeTradeRecord(benchmark::State& state) {
+    auto trade = make_synthetic_trade(42);
+    TradeRecord record;
+
+    for (auto _ : state) {
+        make_trade_record(trade, record);
+        benchmark::DoNotOptimize(record);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MakeTradeRecord);
+
+} // namespace
+
+BENCHMARK_MAIN();
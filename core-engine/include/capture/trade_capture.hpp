@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "messaging/binary_trade_codec.hpp"
+#include "surveillance/trade_pattern_detector.hpp"
+
+namespace dharmaguard {
+namespace capture {
+
+/**
+ * @brief On-disk capture file header
+ *
+ * A capture file is this header followed by an append-only run of
+ * messaging::WireTradeRecord entries - the same fixed layout the binary
+ * Kafka feed uses, so one decoder serves both paths. Records are in
+ * arrival order and carry their original epoch-nanosecond timestamps,
+ * which is what makes timed replay deterministic.
+ */
+#pragma pack(push, 1)
+struct CaptureFileHeader {
+    /// 'DGCP' - DharmaGuard capture
+    static constexpr uint32_t kMagic = 0x50434744;
+    static constexpr uint16_t kVersion = 1;
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint32_t record_size;
+    uint32_t reserved;
+};
+#pragma pack(pop)
+
+/**
+ * @brief Append-only capture writer the ingest path can tee into
+ *
+ * Records are buffered and written in batches so the tee costs one
+ * memcpy per trade in steady state; fwrite and flushing happen every
+ * kFlushBatch records, off the per-record path's critical section only
+ * long enough to swap buffers.
+ */
+class TradeCaptureWriter {
+public:
+    static constexpr size_t kFlushBatch = 1024;
+
+    TradeCaptureWriter() = default;
+    ~TradeCaptureWriter();
+
+    TradeCaptureWriter(const TradeCaptureWriter&) = delete;
+    TradeCaptureWriter& operator=(const TradeCaptureWriter&) = delete;
+
+    /**
+     * @brief Open (or create) a capture file for appending
+     * @param path Capture file path
+     * @return true if the file is ready for appends
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Append one trade record to the capture
+     */
+    void append(const surveillance::TradeRecord& record);
+
+    /**
+     * @brief Flush buffered records to disk
+     */
+    void flush();
+
+    /**
+     * @brief Flush and close the capture file
+     */
+    void close();
+
+    bool is_open() const { return file_ != nullptr; }
+    uint64_t records_written() const { return records_written_; }
+
+private:
+    std::FILE* file_{nullptr};
+    std::vector<messaging::WireTradeRecord> buffer_;
+    uint64_t records_written_{0};
+    std::mutex mutex_;
+
+    void flush_locked();
+};
+
+/**
+ * @brief Memory-mapped reader over a capture file
+ *
+ * Maps the whole file read-only and exposes the record run directly;
+ * replay iterates the mapping without copying or parsing ahead of time.
+ */
+class TradeCaptureReader {
+public:
+    TradeCaptureReader() = default;
+    ~TradeCaptureReader();
+
+    TradeCaptureReader(const TradeCaptureReader&) = delete;
+    TradeCaptureReader& operator=(const TradeCaptureReader&) = delete;
+
+    /**
+     * @brief Map a capture file and validate its header
+     * @param path Capture file path
+     * @return true if the mapping is usable
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmap the capture file
+     */
+    void close();
+
+    /// Number of complete records in the mapping
+    size_t size() const { return record_count_; }
+
+    /// Direct access to record i within the mapping
+    const messaging::WireTradeRecord& record(size_t index) const {
+        return records_[index];
+    }
+
+private:
+    void* mapping_{nullptr};
+    size_t mapping_size_{0};
+    const messaging::WireTradeRecord* records_{nullptr};
+    size_t record_count_{0};
+};
+
+} // namespace capture
+} // namespace dharmaguard
@@ -0,0 +1,309 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <tbb/concurrent_queue.h>
+
+#include <spdlog/spdlog.h>
+
+#include "surveillance/latency_histogram.hpp"
+
+namespace dharmaguard {
+namespace database {
+
+/**
+ * @brief Fixed-size async connection pool with completion-callback jobs
+ *
+ * Gives each logical database one socket per lane and a dedicated worker
+ * thread, so a slow request - hourly maintenance, an archive sweep - only
+ * stalls its own lane instead of serializing everything behind a single
+ * synchronous connection. Callers submit jobs that receive a connection
+ * reference on the lane thread; submission never blocks and is bounded
+ * per lane. Jobs route to the least-loaded lane by default, or to a fixed
+ * lane via submit_to() when a caller wants long-running work pinned away
+ * from the latency-sensitive lanes.
+ *
+ * When the connection type exposes begin_pipeline()/flush_pipeline(), a
+ * lane that finds several queued jobs brackets them in one pipeline so
+ * their round trips overlap on the wire; connections without those
+ * methods run jobs back to back unchanged.
+ */
+template <typename Connection>
+class ConnectionPool {
+public:
+    using Job = std::function<void(Connection&)>;
+    using Factory = std::function<std::unique_ptr<Connection>()>;
+
+    struct Config {
+        /// Number of connections (and worker threads) in the pool
+        size_t connections = 4;
+        /// Per-lane queue bound; submissions beyond it are rejected
+        size_t max_depth = 10000;
+        /// Jobs drained per pipeline bracket when the connection supports it
+        size_t pipeline_batch = 64;
+    };
+
+    /**
+     * @brief Pool counters and queue-to-completion latency quantiles
+     */
+    struct Stats {
+        uint64_t jobs_submitted = 0;
+        uint64_t jobs_completed = 0;
+        uint64_t jobs_rejected = 0;
+        uint64_t queue_depth = 0;
+        uint64_t p50_latency_ns = 0;
+        uint64_t p99_latency_ns = 0;
+    };
+
+    /**
+     * @brief Constructor
+     * @param name Pool name used in log messages
+     * @param factory Creates one connected instance per lane
+     * @param config Sizing and batching configuration
+     */
+    ConnectionPool(std::string name, Factory factory, Config config)
+        : name_(std::move(name))
+        , factory_(std::move(factory))
+        , config_(config)
+    {
+    }
+
+    ~ConnectionPool() {
+        if (running_.load()) {
+            stop();
+        }
+    }
+
+    /**
+     * @brief Open the pool connections and start the lane threads
+     * @return true if every lane connected successfully
+     */
+    bool start() {
+        if (running_.load()) {
+            spdlog::warn("Connection pool '{}' is already running", name_);
+            return false;
+        }
+
+        size_t lane_count = std::max<size_t>(config_.connections, 1);
+        lanes_.reserve(lane_count);
+
+        for (size_t i = 0; i < lane_count; ++i) {
+            auto lane = std::make_unique<Lane>();
+            lane->connection = factory_();
+            if (!lane->connection) {
+                spdlog::error("Connection pool '{}' failed to open connection {}",
+                              name_, i);
+                lanes_.clear();
+                return false;
+            }
+            lanes_.push_back(std::move(lane));
+        }
+
+        running_.store(true);
+        for (auto& lane : lanes_) {
+            lane->worker = std::thread(&ConnectionPool::lane_thread_func,
+                                       this, lane.get());
+        }
+
+        spdlog::info("Connection pool '{}' started - {} connections, pipelining {}",
+                     name_, lane_count, kPipelined ? "on" : "off");
+        return true;
+    }
+
+    /**
+     * @brief Drain outstanding jobs and stop the lane threads
+     */
+    void stop() {
+        if (!running_.load()) {
+            return;
+        }
+
+        running_.store(false);
+        for (auto& lane : lanes_) {
+            if (lane->worker.joinable()) {
+                lane->worker.join();
+            }
+        }
+
+        spdlog::info("Connection pool '{}' stopped - completed: {}, rejected: {}",
+                     name_,
+                     jobs_completed_.load(std::memory_order_relaxed),
+                     jobs_rejected_.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Submit a job to the least-loaded lane
+     *
+     * Never blocks; the job runs on a lane thread with that lane's
+     * connection. Rejected (and counted) when every lane is at its bound.
+     *
+     * @param job Callback invoked with the lane connection
+     * @return true if queued, false if rejected
+     */
+    bool submit(Job job) {
+        size_t best = 0;
+        uint64_t best_depth = UINT64_MAX;
+        for (size_t i = 0; i < lanes_.size(); ++i) {
+            uint64_t depth = lanes_[i]->depth.load(std::memory_order_relaxed);
+            if (depth < best_depth) {
+                best = i;
+                best_depth = depth;
+            }
+        }
+        return submit_to(best, std::move(job));
+    }
+
+    /**
+     * @brief Submit a job to a fixed lane
+     *
+     * Pins related work to one connection - e.g. maintenance sweeps on a
+     * dedicated lane so they never queue behind or ahead of alert writes.
+     *
+     * @param lane_index Lane selector, wrapped modulo the pool size
+     * @param job Callback invoked with the lane connection
+     * @return true if queued, false if rejected
+     */
+    bool submit_to(size_t lane_index, Job job) {
+        if (!running_.load(std::memory_order_relaxed) || lanes_.empty()) {
+            jobs_rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        Lane& lane = *lanes_[lane_index % lanes_.size()];
+        if (lane.depth.load(std::memory_order_relaxed) >= config_.max_depth) {
+            jobs_rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        lane.queue.push(PendingJob{std::move(job),
+                                   std::chrono::steady_clock::now()});
+        lane.depth.fetch_add(1, std::memory_order_relaxed);
+        jobs_submitted_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /** @brief Number of lanes in the pool */
+    size_t size() const { return lanes_.size(); }
+
+    /**
+     * @brief Current pool statistics
+     * @return Snapshot of counters and latency quantiles across all lanes
+     */
+    Stats get_stats() const {
+        Stats stats;
+        stats.jobs_submitted = jobs_submitted_.load(std::memory_order_relaxed);
+        stats.jobs_completed = jobs_completed_.load(std::memory_order_relaxed);
+        stats.jobs_rejected = jobs_rejected_.load(std::memory_order_relaxed);
+
+        std::array<uint64_t, surveillance::LatencyHistogram::kBucketCount> counts{};
+        for (const auto& lane : lanes_) {
+            stats.queue_depth += lane->depth.load(std::memory_order_relaxed);
+            lane->latency.accumulate_into(counts);
+        }
+        stats.p50_latency_ns = surveillance::LatencyHistogram::quantile(counts, 0.50);
+        stats.p99_latency_ns = surveillance::LatencyHistogram::quantile(counts, 0.99);
+        return stats;
+    }
+
+private:
+    struct PendingJob {
+        Job fn;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    struct alignas(64) Lane {
+        std::unique_ptr<Connection> connection;
+        tbb::concurrent_queue<PendingJob> queue;
+        std::atomic<uint64_t> depth{0};
+        surveillance::LatencyHistogram latency;
+        std::thread worker;
+    };
+
+    // Detected at compile time so aspirational connection types opt in to
+    // pipelined brackets just by growing the two methods
+    static constexpr bool kPipelined = requires(Connection& c) {
+        c.begin_pipeline();
+        c.flush_pipeline();
+    };
+
+    void lane_thread_func(Lane* lane) {
+        std::vector<PendingJob> batch;
+        batch.reserve(config_.pipeline_batch);
+
+        while (running_.load() ||
+               lane->depth.load(std::memory_order_relaxed) > 0) {
+            PendingJob job;
+            while (batch.size() < config_.pipeline_batch &&
+                   lane->queue.try_pop(job)) {
+                lane->depth.fetch_sub(1, std::memory_order_relaxed);
+                batch.push_back(std::move(job));
+            }
+
+            if (batch.empty()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+
+            run_batch(*lane, batch);
+            batch.clear();
+        }
+    }
+
+    void run_batch(Lane& lane, std::vector<PendingJob>& batch) {
+        if constexpr (kPipelined) {
+            if (batch.size() > 1) {
+                lane.connection->begin_pipeline();
+            }
+        }
+
+        for (auto& job : batch) {
+            try {
+                job.fn(*lane.connection);
+            } catch (const std::exception& e) {
+                spdlog::error("Connection pool '{}' job failed: {}",
+                              name_, e.what());
+            }
+        }
+
+        if constexpr (kPipelined) {
+            if (batch.size() > 1) {
+                try {
+                    lane.connection->flush_pipeline();
+                } catch (const std::exception& e) {
+                    spdlog::error("Connection pool '{}' pipeline flush failed: {}",
+                                  name_, e.what());
+                }
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        for (const auto& job : batch) {
+            lane.latency.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    now - job.enqueued).count()));
+        }
+        jobs_completed_.fetch_add(batch.size(), std::memory_order_relaxed);
+    }
+
+    std::string name_;
+    Factory factory_;
+    Config config_;
+
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    std::atomic<bool> running_{false};
+
+    std::atomic<uint64_t> jobs_submitted_{0};
+    std::atomic<uint64_t> jobs_completed_{0};
+    std::atomic<uint64_t> jobs_rejected_{0};
+};
+
+} // namespace database
+} // namespace dharmaguard
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "surveillance/surveillance_alert.hpp"
+
+namespace dharmaguard {
+namespace grpc {
+
+/**
+ * @brief Fan-out broker feeding server-streaming alert RPCs
+ *
+ * The alert dispatcher publishes each alert once; every streaming
+ * subscriber has its own bounded queue, severity filter and batch size.
+ * Backpressure is per subscriber: a slow consumer overflows only its own
+ * queue (oldest entries are dropped and counted) and can never back up
+ * the engine's alert_queue_ or other subscribers. Handlers block on
+ * next_batch() instead of polling, which removes the 1-second
+ * GetStatistics/GetAlerts polling loops downstream systems used before.
+ */
+class AlertStreamBroker {
+public:
+    struct SubscriptionOptions {
+        /// Alerts delivered per stream message
+        size_t batch_size = 64;
+        /// Minimum severity forwarded to this subscriber
+        surveillance::AlertSeverity min_severity = surveillance::AlertSeverity::LOW;
+        /// Bounded per-subscriber queue; overflow drops oldest
+        size_t max_queue_depth = 8192;
+    };
+
+    /**
+     * @brief One streaming client's view of the alert flow
+     */
+    class Subscription {
+    public:
+        /**
+         * @brief Wait for the next batch of alerts
+         *
+         * Returns as soon as batch_size alerts are available, or with a
+         * partial batch after the timeout, or empty-handed when the
+         * subscription is cancelled.
+         *
+         * @param batch Output batch; cleared and refilled
+         * @param timeout Maximum time to wait for a full batch
+         * @return false once the subscription is cancelled and drained
+         */
+        bool next_batch(std::vector<surveillance::SurveillanceAlert>& batch,
+                        std::chrono::milliseconds timeout);
+
+        /** @brief Alerts dropped due to this subscriber's backpressure */
+        uint64_t dropped_count() const {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+        /** @brief Cancel the subscription and wake any blocked handler */
+        void cancel();
+
+    private:
+        friend class AlertStreamBroker;
+
+        explicit Subscription(SubscriptionOptions options)
+            : options_(options) {}
+
+        void offer(const surveillance::SurveillanceAlert& alert);
+
+        SubscriptionOptions options_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<surveillance::SurveillanceAlert> queue_;
+        std::atomic<uint64_t> dropped_{0};
+        std::atomic<bool> cancelled_{false};
+    };
+
+    /**
+     * @brief Register a new streaming subscriber
+     * @param options Batch size, severity filter and queue bound
+     * @return Subscription handle owned jointly with the broker
+     */
+    std::shared_ptr<Subscription> subscribe(SubscriptionOptions options);
+
+    /**
+     * @brief Remove a subscriber and cancel its pending waits
+     * @param subscription Handle returned by subscribe()
+     */
+    void unsubscribe(const std::shared_ptr<Subscription>& subscription);
+
+    /**
+     * @brief Fan an alert out to all matching subscribers
+     * @param alert Alert from the dispatcher
+     */
+    void publish(const surveillance::SurveillanceAlert& alert);
+
+    /** @brief Number of active subscriptions */
+    size_t subscriber_count() const;
+
+private:
+    mutable std::mutex subscribers_mutex_;
+    std::vector<std::shared_ptr<Subscription>> subscribers_;
+};
+
+} // namespace grpc
+} // namespace dharmaguard
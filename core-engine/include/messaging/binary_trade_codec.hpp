@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "surveillance/trade_pattern_detector.hpp"
+
+namespace dharmaguard {
+namespace messaging {
+
+/**
+ * @brief Fixed-layout binary wire format for trade ingestion
+ *
+ * The feed handler emits Kafka messages containing a batch header followed
+ * by densely packed WireTradeRecords. Every field has a fixed offset and
+ * width, so decoding is a bounds check plus direct field reads - no JSON,
+ * no intermediate string construction. Identifier fields are fixed-width
+ * NUL-padded byte arrays that decode straight into interned IDs or the
+ * inline arrays of surveillance::TradeRecord.
+ */
+#pragma pack(push, 1)
+
+struct WireBatchHeader {
+    /// 'DGTB' - DharmaGuard trade batch
+    static constexpr uint32_t kMagic = 0x42544744;
+    static constexpr uint16_t kVersion = 1;
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint32_t record_count;
+};
+
+struct WireTradeRecord {
+    char trade_id[24];
+    char order_id[24];
+    char instrument_symbol[16];
+    char account_id[16];
+    char client_id[16];
+    char exchange[8];
+    char trader_id[16];
+
+    uint8_t trade_type;       // surveillance::TradeData::TradeType
+    uint8_t segment;          // surveillance::TradeData::MarketSegment
+    uint8_t is_own_account;
+    uint8_t reserved;
+
+    uint64_t quantity;
+    double price;
+    double value;
+    double brokerage;
+    double taxes;
+    int64_t timestamp_ns;     // epoch nanoseconds
+};
+
+#pragma pack(pop)
+
+/**
+ * @brief Batch decoder from the binary wire format into hot-path records
+ */
+class BinaryTradeCodec {
+public:
+    /**
+     * @brief Decode a whole Kafka message batch into TradeRecords
+     *
+     * Validates the header and record framing, then parses each wire
+     * record directly into the output vector (reused across calls by the
+     * ingest thread, so steady-state decoding allocates nothing).
+     *
+     * @param payload Raw Kafka message payload
+     * @param size Payload size in bytes
+     * @param records Output records; cleared and refilled
+     * @return Number of records decoded, 0 on malformed input
+     */
+    static size_t decode_batch(const void* payload, size_t size,
+                               std::vector<surveillance::TradeRecord>& records);
+
+    /**
+     * @brief Encode records into the wire format (capture/replay, tests)
+     * @param records Records to encode
+     * @param payload Output buffer; cleared and refilled
+     */
+    static void encode_batch(const std::vector<surveillance::TradeRecord>& records,
+                             std::vector<uint8_t>& payload);
+
+    /**
+     * @brief Decode a single wire record (capture replay path)
+     */
+    static void decode_record(const WireTradeRecord& wire,
+                              surveillance::TradeRecord& record);
+
+    /**
+     * @brief Encode a single record into the wire layout (capture tee path)
+     */
+    static void encode_record(const surveillance::TradeRecord& record,
+                              WireTradeRecord& wire);
+};
+
+} // namespace messaging
+} // namespace dharmaguard
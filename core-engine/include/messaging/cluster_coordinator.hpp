@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "database/redis_connection.hpp"
+#include "surveillance/trade_pattern_detector.hpp"
+
+namespace dharmaguard {
+namespace messaging {
+
+/**
+ * @brief Deterministic instrument-to-partition shard map for a cluster
+ *
+ * Instruments hash to Kafka partitions and partitions are assigned to
+ * engine nodes, so partition assignment alone decides which box sees
+ * which instrument - no per-trade routing or filtering. Co-traded
+ * instruments declared in a correlation group hash through the shared
+ * group key instead of their own symbol, keeping them on one node for
+ * the cross-instrument detectors.
+ */
+struct ShardMap {
+    uint64_t version = 0;
+    uint32_t kafka_partitions = 0;
+    /// Partition index -> owning node ID
+    std::vector<uint32_t> partition_owners;
+    /// Instrument symbol -> correlation group key
+    std::unordered_map<std::string, std::string> correlation_groups;
+
+    std::string to_json() const;
+    static std::optional<ShardMap> from_json(const std::string& json);
+};
+
+/**
+ * @brief Cluster-wide counters aggregated from every node's stats
+ */
+struct ClusterStats {
+    uint32_t nodes_reporting = 0;
+    uint64_t total_trades_processed = 0;
+    uint64_t total_alerts_generated = 0;
+    double throughput_trades_per_second = 0.0;
+    uint64_t trades_rejected = 0;
+    uint64_t duplicates_suppressed = 0;
+    std::unordered_map<std::string, uint64_t> pattern_alerts_count;
+};
+
+/**
+ * @brief Shard map distribution and stats aggregation between engines
+ *
+ * One surveillance engine per box stops scaling once the market doubles;
+ * clustered mode splits the market by Kafka partition. The coordinator
+ * keeps the authoritative shard map in Redis: the lowest node publishes
+ * the initial assignment derived from its config, every node polls for
+ * newer versions, and a version bump fires the rebalance callback so
+ * the engine can realign its Kafka assignment and cut a context
+ * snapshot for the partitions it hands off. Each node also publishes
+ * its ProcessingStats under a per-node key with a short TTL, and any
+ * node (the gRPC stats endpoint in practice) can sum them into a
+ * cluster-wide view.
+ */
+class ClusterCoordinator {
+public:
+    struct Config {
+        /// This engine's node ID, in [0, total_nodes)
+        uint32_t node_id = 0;
+        /// Engines sharing the market
+        uint32_t total_nodes = 1;
+        /// Partition count of the trade topic; the hash modulus
+        uint32_t kafka_partitions = 16;
+        /// Shard map poll cadence
+        std::chrono::seconds refresh_interval{10};
+        /// Redis key holding the serialized shard map
+        std::string map_key = "cluster:shard_map";
+        /// Per-node stats keys are this prefix plus the node ID
+        std::string stats_key_prefix = "cluster:stats:";
+    };
+
+    using RebalanceCallback =
+        std::function<void(const ShardMap& previous, const ShardMap& current)>;
+
+    /**
+     * @brief Constructor
+     * @param redis Redis connection used for map and stats distribution
+     * @param config Cluster topology and key configuration
+     */
+    ClusterCoordinator(database::RedisConnection* redis, Config config);
+
+    ~ClusterCoordinator();
+
+    /**
+     * @brief Declare a correlation group before start()
+     *
+     * Cross-instrument detectors use this to pin co-traded instruments
+     * to one node: every listed symbol hashes through the group key.
+     *
+     * @param group Group key the instruments hash through
+     * @param instruments Symbols that must share a shard
+     */
+    void declare_correlation_group(const std::string& group,
+                                   const std::vector<std::string>& instruments);
+
+    /**
+     * @brief Fetch or publish the shard map and start the refresh thread
+     * @return true if a map was obtained
+     */
+    bool start();
+
+    /**
+     * @brief Stop the refresh thread
+     */
+    void stop();
+
+    /**
+     * @brief Partition an instrument hashes to under the current map
+     * @param instrument_symbol Instrument symbol
+     * @return Kafka partition index
+     */
+    uint32_t partition_for(const std::string& instrument_symbol) const;
+
+    /**
+     * @brief Whether this node owns an instrument's partition
+     * @param instrument_symbol Instrument symbol
+     * @return true when the instrument routes to this node
+     */
+    bool owns_instrument(const std::string& instrument_symbol) const;
+
+    /**
+     * @brief Kafka partitions assigned to this node
+     * @return Partition indices to pass to the consumer
+     */
+    std::vector<int32_t> owned_partitions() const;
+
+    /**
+     * @brief Callback fired when a newer shard map version is observed
+     * @param callback Invoked with the previous and the new map
+     */
+    void set_rebalance_callback(RebalanceCallback callback);
+
+    /**
+     * @brief Publish this node's stats under its per-node key
+     * @param stats Local ProcessingStats snapshot
+     */
+    void publish_local_stats(const surveillance::ProcessingStats& stats);
+
+    /**
+     * @brief Sum the per-node stats of every reachable node
+     * @return Cluster-wide aggregate; nodes_reporting says how complete
+     */
+    ClusterStats aggregate_cluster_stats() const;
+
+    /** @brief Current shard map version */
+    uint64_t map_version() const;
+
+private:
+    ShardMap build_default_map() const;
+    void refresh_thread_func();
+    bool adopt_if_newer(const ShardMap& fetched);
+    static uint64_t hash_key(const std::string& key);
+
+    database::RedisConnection* redis_;
+    Config config_;
+
+    mutable std::shared_mutex map_mutex_;
+    ShardMap map_;
+
+    std::unordered_map<std::string, std::string> pending_groups_;
+
+    RebalanceCallback rebalance_callback_;
+    std::thread refresh_thread_;
+    std::atomic<bool> running_{false};
+};
+
+} // namespace messaging
+} // namespace dharmaguard
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <tbb/concurrent_queue.h>
+
+#include "database/connection_pool.hpp"
+#include "database/postgres_connection.hpp"
+#include "database/redis_connection.hpp"
+#include "surveillance/surveillance_alert.hpp"
+
+namespace dharmaguard {
+namespace persistence {
+
+/**
+ * @brief Write-behind persistence stage for surveillance alerts
+ *
+ * Decouples alert generation from database round-trips: alerts are
+ * enqueued without blocking and a dedicated writer thread flushes them in
+ * batches - Postgres via a single COPY/multi-row insert and Redis via one
+ * pipelined round trip - on a size-or-time trigger. The queue is bounded;
+ * on overflow, batches spill to an append-only on-disk journal rather
+ * than backing up into the detection path, and are replayed on the next
+ * flush cycle with spare capacity.
+ */
+class AlertWriter {
+public:
+    struct Config {
+        /// Alerts per Postgres COPY / Redis pipeline flush
+        size_t max_batch_size = 500;
+        /// Flush even a partial batch after this long
+        std::chrono::milliseconds flush_interval{100};
+        /// Bounded in-memory queue depth before spilling to disk
+        size_t max_queue_depth = 100000;
+        /// Append-only journal for overflow alerts
+        std::string spill_path = "alert_spill.journal";
+    };
+
+    /**
+     * @brief Persistence counters for monitoring
+     */
+    struct Stats {
+        uint64_t alerts_persisted = 0;
+        uint64_t alerts_spilled = 0;
+        uint64_t alerts_replayed = 0;
+        uint64_t flush_count = 0;
+        uint64_t queue_depth = 0;
+    };
+
+    /**
+     * @brief Constructor
+     * @param postgres Postgres connection used for batched inserts
+     * @param redis Redis connection used for pipelined caching
+     * @param config Batching and overflow configuration
+     */
+    AlertWriter(database::PostgresConnection* postgres,
+                database::RedisConnection* redis,
+                Config config = {});
+
+    ~AlertWriter();
+
+    /**
+     * @brief Start the background writer thread
+     * @return true if started successfully
+     */
+    bool start();
+
+    /**
+     * @brief Flush remaining alerts and stop the writer thread
+     */
+    void stop();
+
+    /**
+     * @brief Enqueue an alert for asynchronous persistence
+     *
+     * Never blocks; when the bounded queue is full the alert is spilled
+     * to the on-disk journal instead.
+     *
+     * @param alert Alert to persist
+     * @return true if queued in memory, false if spilled
+     */
+    bool enqueue(const surveillance::SurveillanceAlert& alert);
+
+    /**
+     * @brief Route flushes through async connection pools
+     *
+     * With pools attached, the Postgres and Redis halves of each flush
+     * run concurrently on pool lanes instead of back to back on the two
+     * direct connections, and neither shares a socket with maintenance
+     * work. Must be called before start(); pass nullptr to keep the
+     * direct-connection path.
+     *
+     * @param postgres_pool Pool used for batched inserts
+     * @param redis_pool Pool used for pipelined caching
+     */
+    void set_connection_pools(
+        database::ConnectionPool<database::PostgresConnection>* postgres_pool,
+        database::ConnectionPool<database::RedisConnection>* redis_pool);
+
+    /**
+     * @brief Current persistence statistics
+     * @return Snapshot of the writer counters
+     */
+    Stats get_stats() const;
+
+private:
+    void writer_thread_func();
+    void flush_batch(std::vector<surveillance::SurveillanceAlert>& batch);
+    void spill_to_disk(const surveillance::SurveillanceAlert& alert);
+    void replay_spilled(size_t budget);
+
+    database::PostgresConnection* postgres_;
+    database::RedisConnection* redis_;
+    database::ConnectionPool<database::PostgresConnection>* postgres_pool_ = nullptr;
+    database::ConnectionPool<database::RedisConnection>* redis_pool_ = nullptr;
+    Config config_;
+
+    tbb::concurrent_queue<surveillance::SurveillanceAlert> queue_;
+    std::atomic<uint64_t> queue_depth_{0};
+    std::thread writer_thread_;
+    std::atomic<bool> running_{false};
+
+    std::atomic<uint64_t> alerts_persisted_{0};
+    std::atomic<uint64_t> alerts_spilled_{0};
+    std::atomic<uint64_t> alerts_replayed_{0};
+    std::atomic<uint64_t> flush_count_{0};
+
+    std::mutex spill_mutex_;
+};
+
+} // namespace persistence
+} // namespace dharmaguard
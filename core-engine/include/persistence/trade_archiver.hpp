@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <tbb/concurrent_queue.h>
+
+#include "database/clickhouse_connection.hpp"
+#include "surveillance/trade_pattern_detector.hpp"
+
+namespace dharmaguard {
+namespace persistence {
+
+/**
+ * @brief One sealed columnar block of archived trades
+ *
+ * Struct-of-arrays layout matching the ClickHouse trades table: each
+ * column inserts as one contiguous, compressible run. Identifier columns
+ * hold interned IDs; the symbol/account dictionaries are resolved at
+ * insert time so ClickHouse stores LowCardinality strings.
+ */
+struct TradeColumnBlock {
+    std::vector<int64_t> timestamps_ns;
+    std::vector<double> prices;
+    std::vector<double> values;
+    std::vector<uint64_t> quantities;
+    std::vector<uint32_t> instrument_ids;
+    std::vector<uint32_t> account_ids;
+    std::vector<uint32_t> client_ids;
+    std::vector<uint32_t> exchange_ids;
+    std::vector<uint32_t> trader_ids;
+    std::vector<uint8_t> trade_types;
+    std::vector<uint8_t> segments;
+
+    size_t rows() const { return timestamps_ns.size(); }
+
+    void reserve(size_t capacity);
+    void clear();
+    void append(const surveillance::TradeRecord& record);
+};
+
+/**
+ * @brief Asynchronous columnar trade archival into ClickHouse
+ *
+ * Archival stage fed by the detection workers after
+ * process_trade_internal(): each worker appends into its own column
+ * block (single writer, no locking), seals the block onto a queue when
+ * it reaches block_rows, and a background thread inserts sealed blocks
+ * into ClickHouse as large compressed column runs. Sealed blocks are
+ * recycled through a free list, so steady-state archival allocates
+ * nothing. If the pending queue backs up past max_pending_blocks, the
+ * oldest block is dropped and counted - archival never backpressures
+ * detection.
+ */
+class TradeArchiver {
+public:
+    struct Config {
+        /// Rows per sealed block / ClickHouse insert
+        size_t block_rows = 65536;
+        /// Sealed blocks allowed to queue before the oldest is dropped
+        size_t max_pending_blocks = 64;
+        /// Seal even a partial block after this long
+        std::chrono::seconds max_block_age{5};
+        /// Target table
+        std::string table = "trades_archive";
+    };
+
+    /**
+     * @brief Archival counters for monitoring
+     */
+    struct Stats {
+        uint64_t rows_archived = 0;
+        uint64_t blocks_flushed = 0;
+        uint64_t blocks_dropped = 0;
+        uint64_t pending_blocks = 0;
+    };
+
+    /**
+     * @brief Constructor
+     * @param clickhouse ClickHouse connection used for block inserts
+     * @param num_shards Worker shard count (one column buffer each)
+     * @param config Block sizing and overflow configuration
+     */
+    TradeArchiver(database::ClickHouseConnection* clickhouse,
+                  size_t num_shards,
+                  Config config);
+
+    ~TradeArchiver();
+
+    /**
+     * @brief Start the background flush thread
+     * @return true if started successfully
+     */
+    bool start();
+
+    /**
+     * @brief Seal and flush all remaining blocks, then stop
+     */
+    void stop();
+
+    /**
+     * @brief Append one processed trade to a shard's column buffer
+     *
+     * Must be called only from the worker that owns shard_index - same
+     * single-writer rule as the context shards. Never blocks.
+     *
+     * @param shard_index Owning worker shard
+     * @param record Trade to archive
+     */
+    void append(size_t shard_index, const surveillance::TradeRecord& record);
+
+    /**
+     * @brief Current archival statistics
+     * @return Snapshot of the archiver counters
+     */
+    Stats get_stats() const;
+
+private:
+    // Worker-owned active block, padded so neighbouring shards don't
+    // false-share
+    struct alignas(64) ShardBuffer {
+        std::unique_ptr<TradeColumnBlock> active;
+        std::chrono::steady_clock::time_point first_append;
+    };
+
+    void flush_thread_func();
+    void seal_block(size_t shard_index);
+    std::unique_ptr<TradeColumnBlock> take_block();
+
+    database::ClickHouseConnection* clickhouse_;
+    Config config_;
+
+    std::vector<ShardBuffer> shard_buffers_;
+    tbb::concurrent_queue<std::unique_ptr<TradeColumnBlock>> pending_;
+    tbb::concurrent_queue<std::unique_ptr<TradeColumnBlock>> free_list_;
+    std::atomic<uint64_t> pending_count_{0};
+
+    std::thread flush_thread_;
+    std::atomic<bool> running_{false};
+    std::mutex flush_mutex_;
+    std::condition_variable flush_cv_;
+
+    std::atomic<uint64_t> rows_archived_{0};
+    std::atomic<uint64_t> blocks_flushed_{0};
+    std::atomic<uint64_t> blocks_dropped_{0};
+};
+
+} // namespace persistence
+} // namespace dharmaguard
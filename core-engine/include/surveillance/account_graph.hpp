@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dharmaguard {
+namespace surveillance {
+
+struct TradeRecord;
+
+/**
+ * @brief Incremental account-relationship graph over interned IDs
+ *
+ * Replaces the per-context related_accounts/related_instruments string
+ * vectors with one process-wide index that is updated as trades arrive
+ * and queried in microseconds:
+ *
+ *  - Cluster membership is a lock-free union-find over interned IDs.
+ *    Accounts are unioned with their client ID, so every account of a
+ *    group-account broker lands in one cluster through the shared client
+ *    hub; same_cluster() is two find() calls regardless of cluster size.
+ *  - Neighborhoods are capped per-node adjacency rings (account <->
+ *    instrument edges), giving bounded k-hop expansion for the
+ *    cross-account detectors.
+ *
+ * All IDs index directly into flat arrays - no hashing, no strings. IDs
+ * beyond the fixed capacity are ignored for updates and degenerate to
+ * singleton clusters for queries, so the structure's footprint is set
+ * once at construction. Safe for concurrent update and query from all
+ * worker threads.
+ */
+class AccountGraph {
+public:
+    /// Neighbors retained per node; older edges are overwritten ring-style
+    static constexpr size_t kMaxNeighbors = 8;
+
+    /// Default ID capacity; covers the account/client/instrument universe
+    static constexpr size_t kDefaultCapacity = 1 << 20;
+
+    explicit AccountGraph(size_t capacity = kDefaultCapacity);
+
+    AccountGraph(const AccountGraph&) = delete;
+    AccountGraph& operator=(const AccountGraph&) = delete;
+
+    /**
+     * @brief Fold one trade into the graph
+     *
+     * Unions the account with its client hub and records the
+     * account <-> instrument edge in both adjacency rings.
+     *
+     * @param trade Trade being processed
+     */
+    void observe_trade(const TradeRecord& trade);
+
+    /**
+     * @brief Explicitly link two IDs into one cluster
+     * @param a First interned ID
+     * @param b Second interned ID
+     */
+    void link(uint32_t a, uint32_t b);
+
+    /**
+     * @brief Cluster representative for an ID
+     * @param id Interned ID
+     * @return Root ID; equal roots mean same cluster
+     */
+    uint32_t cluster_of(uint32_t id);
+
+    /**
+     * @brief Whether two IDs are in the same cluster
+     */
+    bool same_cluster(uint32_t a, uint32_t b) {
+        return cluster_of(a) == cluster_of(b);
+    }
+
+    /**
+     * @brief Number of IDs merged into an ID's cluster
+     *
+     * Maintained at the root during unions; approximate under concurrent
+     * updates, which is adequate for threshold checks.
+     */
+    uint32_t cluster_size(uint32_t id);
+
+    /**
+     * @brief Copy a node's current neighbors
+     * @param id Interned ID
+     * @param out Receives up to kMaxNeighbors neighbor IDs
+     * @return Number of neighbors written
+     */
+    size_t neighbors(uint32_t id, std::array<uint32_t, kMaxNeighbors>& out) const;
+
+    /**
+     * @brief Bounded breadth-first k-hop neighborhood
+     *
+     * Expands over the adjacency rings up to k hops from start, visiting
+     * at most max_nodes IDs; the result alternates between account and
+     * instrument IDs by construction of the bipartite edges.
+     *
+     * @param start Interned ID to expand from
+     * @param hops Maximum hop count
+     * @param out Cleared and filled with visited IDs (excluding start)
+     * @param max_nodes Hard cap on result size
+     */
+    void k_hop_neighborhood(uint32_t start, size_t hops,
+                            std::vector<uint32_t>& out,
+                            size_t max_nodes = 256);
+
+private:
+    struct Node {
+        std::atomic<uint32_t> parent{0};
+        std::atomic<uint32_t> cluster_size{1};
+        std::atomic<uint32_t> neighbor_count{0};
+        std::array<std::atomic<uint32_t>, kMaxNeighbors> neighbors{};
+    };
+
+    std::vector<Node> nodes_;
+
+    bool in_range(uint32_t id) const { return id != 0 && id < nodes_.size(); }
+
+    uint32_t find(uint32_t id);
+    void add_neighbor(uint32_t from, uint32_t to);
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
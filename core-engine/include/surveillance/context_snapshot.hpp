@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "surveillance/trade_pattern_detector.hpp"
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief On-disk snapshot file header
+ *
+ * A snapshot is this header, a string table for every interned ID live at
+ * snapshot time, then a raw run of TradeRecords - the window contents of
+ * every context across all shards. Interned IDs are process-local, so the
+ * string table is what makes records meaningful after a restart: the
+ * loader re-interns each string and remaps record IDs through the
+ * resulting translation table.
+ */
+#pragma pack(push, 1)
+struct SnapshotFileHeader {
+    /// 'DGSN' - DharmaGuard snapshot
+    static constexpr uint32_t kMagic = 0x4e534744;
+    static constexpr uint16_t kVersion = 1;
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint32_t record_size;
+    uint32_t string_count;
+    uint64_t record_count;
+    int64_t snapshot_time_ns;
+};
+#pragma pack(pop)
+
+/**
+ * @brief Writer/loader for warm-restart context snapshots
+ *
+ * Writing is atomic: the image is built in a memory-mapped temp file and
+ * renamed over the target, so a crash mid-snapshot leaves the previous
+ * snapshot intact. Loading maps the file read-only and streams records
+ * through a sink; combined with a capture-file --replay of the gap since
+ * snapshot_time, the detectors reach full window fidelity within seconds
+ * of process start.
+ */
+class ContextSnapshot {
+public:
+    /**
+     * @brief Write a snapshot atomically
+     * @param path Target snapshot path
+     * @param records Window contents of every live context, per-context
+     *                oldest-first
+     * @param snapshot_time Wall-clock time the shards were serialized
+     * @return true if the snapshot was durably written and renamed
+     */
+    static bool write(const std::string& path,
+                      const std::vector<TradeRecord>& records,
+                      std::chrono::system_clock::time_point snapshot_time);
+
+    /**
+     * @brief Stream a snapshot's records through a sink
+     *
+     * Re-interns the string table, remaps each record's interned IDs to
+     * the current process's IDs and hands it to the sink. Malformed files
+     * are rejected whole rather than partially applied.
+     *
+     * @param path Snapshot path
+     * @param sink Receives each remapped record
+     * @return true if the snapshot was valid and fully streamed
+     */
+    static bool load(const std::string& path,
+                     const std::function<void(const TradeRecord&)>& sink);
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "surveillance/trade_pattern_detector.hpp"
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Bounded open-addressing store for per-(instrument, account) contexts
+ *
+ * Replaces the unbounded per-shard hash maps: capacity is fixed at
+ * construction, so the resident set for context state cannot grow past
+ * what was provisioned, no matter how many (instrument, account) pairs an
+ * expiry day produces. Keys are the packed 64-bit (instrument_id,
+ * account_id) interned-ID pair - no string construction anywhere on the
+ * lookup path.
+ *
+ * Probing is windowed: lookups and inserts scan a fixed run of
+ * kProbeWindow slots from the home position, with key/recency metadata
+ * held in a separate flat array so a probe touches a couple of cache
+ * lines rather than the (large) contexts themselves. When a window has no
+ * free slot, the store reclaims in order of preference: a context idle
+ * past the TTL (normally the detector lookback window), else the
+ * least-recently-touched context in the window. Single-threaded by
+ * design - each worker owns its shard's store exclusively.
+ */
+class ContextStore {
+public:
+    static constexpr size_t kProbeWindow = 16;
+    static constexpr size_t kDefaultCapacity = 1 << 16;
+
+    /**
+     * @brief Construct a store with fixed capacity
+     * @param capacity Slot count, rounded up to a power of two
+     * @param ttl Idle time after which a context is reclaimable
+     */
+    explicit ContextStore(size_t capacity = kDefaultCapacity,
+                          std::chrono::nanoseconds ttl = std::chrono::minutes(5));
+
+    ContextStore(const ContextStore&) = delete;
+    ContextStore& operator=(const ContextStore&) = delete;
+
+    /**
+     * @brief Look up or create the context for a packed key
+     *
+     * Touches the entry's recency stamp. If the probe window is full, an
+     * idle or least-recently-used context in the window is reset and its
+     * slot reused.
+     *
+     * @param key Packed (instrument_id << 32) | account_id, never zero
+     * @param now Timestamp of the trade being processed
+     * @return Context for the key, valid until the next eviction of it
+     */
+    HistoricalContext& get_or_create(uint64_t key,
+                                     std::chrono::system_clock::time_point now);
+
+    /**
+     * @brief Visit every live context (snapshotting, diagnostics)
+     *
+     * Must only be called from the owning worker thread - the same
+     * single-writer rule as get_or_create().
+     *
+     * @param fn Callable taking (uint64_t key, const HistoricalContext&)
+     */
+    template <typename Fn>
+    void for_each_context(Fn&& fn) const {
+        for (size_t slot = 0; slot < meta_.size(); ++slot) {
+            if (meta_[slot].key != 0) {
+                fn(meta_[slot].key, contexts_[slot]);
+            }
+        }
+    }
+
+    /// Live contexts currently held
+    size_t size() const { return size_; }
+
+    /// Total slots
+    size_t capacity() const { return meta_.size(); }
+
+    /// Fraction of slots occupied, 0.0 - 1.0
+    double occupancy() const {
+        return static_cast<double>(size_) / static_cast<double>(meta_.size());
+    }
+
+    /// Contexts reclaimed because they idled past the TTL
+    uint64_t ttl_evictions() const { return ttl_evictions_; }
+
+    /// Live contexts displaced by LRU pressure (capacity signal)
+    uint64_t lru_evictions() const { return lru_evictions_; }
+
+private:
+    struct SlotMeta {
+        uint64_t key = 0;            // 0 = empty
+        int64_t last_access_ns = 0;  // epoch nanoseconds of last touch
+    };
+
+    std::vector<SlotMeta> meta_;
+    std::vector<HistoricalContext> contexts_;
+    size_t mask_;
+    int64_t ttl_ns_;
+    size_t size_ = 0;
+    uint64_t ttl_evictions_ = 0;
+    uint64_t lru_evictions_ = 0;
+
+    // splitmix64 finalizer; packed IDs are dense and sequential, so they
+    // need real mixing before masking
+    static uint64_t mix(uint64_t key) {
+        key ^= key >> 30;
+        key *= 0xbf58476d1ce4e5b9ULL;
+        key ^= key >> 27;
+        key *= 0x94d049bb133111ebULL;
+        key ^= key >> 31;
+        return key;
+    }
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "surveillance/trade_pattern_detector.hpp"
+#include "surveillance/detector_profiles.hpp"
+#include "surveillance/hot_path_tracer.hpp"
+#include "surveillance/pump_dump_detector.hpp"
+#include "surveillance/layering_detector.hpp"
+#include "surveillance/wash_trading_detector.hpp"
+#include "surveillance/insider_trading_detector.hpp"
+#include "surveillance/front_running_detector.hpp"
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Compile-time pipeline over the five built-in pattern detectors
+ *
+ * Holds the built-ins by value in a tuple and invokes detect_pattern()
+ * through direct member calls that the compiler can devirtualize and
+ * inline - no shared_ptr refcount traffic, no indirect calls, and no
+ * per-trade vector of enabled detectors. The detector set is fixed at
+ * start(); only rarely-used custom plugins remain in the dynamic
+ * registry. Toggling and configuration go through the by-name lookups
+ * below, which fold to the matching tuple element.
+ */
+class BuiltinDetectorPipeline {
+public:
+    /**
+     * @brief Marks detectors whose per-trade cost justifies offloading
+     *
+     * Heavyweight detectors (cross-reference scans over long horizons)
+     * can be executed on the offload pool in batches instead of inline on
+     * the worker; everything else is cheap enough that task overhead
+     * would dominate.
+     */
+    template <typename Detector>
+    struct IsHeavyweight : std::false_type {};
+
+    /**
+     * @brief Run every enabled built-in against a trade
+     * @param trade Current trade record
+     * @param context Historical context for the trade's shard
+     * @param sink Callable (const std::string& name, SurveillanceAlert&&)
+     *        invoked for each alert produced
+     */
+    template <typename Sink>
+    void run(const TradeRecord& trade, const HistoricalContext& context, Sink&& sink) {
+        with_profile([&](auto profile) {
+            std::apply([&](auto&... detector) {
+                (run_one(profile, detector, trade, context, sink), ...);
+            }, detectors_);
+        });
+    }
+
+    /**
+     * @brief Run every enabled built-in, timing each one (sampled trades)
+     *
+     * Same execution as run() plus a TSC bracket around each
+     * detect_pattern() call; only taken on trades the tracer sampled, so
+     * the extra reads stay off the common path.
+     *
+     * @param timer Callable (const std::string& name, uint64_t cycles)
+     */
+    template <typename Sink, typename Timer>
+    void run_traced(const TradeRecord& trade, const HistoricalContext& context,
+                    Sink&& sink, Timer&& timer) {
+        with_profile([&](auto profile) {
+            std::apply([&](auto&... detector) {
+                (run_one_traced(profile, detector, trade, context, sink, timer), ...);
+            }, detectors_);
+        });
+    }
+
+    /**
+     * @brief Run only the lightweight built-ins (offload mode)
+     */
+    template <typename Sink>
+    void run_light(const TradeRecord& trade, const HistoricalContext& context, Sink&& sink) {
+        with_profile([&](auto profile) {
+            std::apply([&](auto&... detector) {
+                ((IsHeavyweight<std::decay_t<decltype(detector)>>::value
+                      ? void()
+                      : run_one(profile, detector, trade, context, sink)), ...);
+            }, detectors_);
+        });
+    }
+
+    /**
+     * @brief Run only the heavyweight built-ins (offload pool)
+     *
+     * Called from offload tasks, potentially concurrently; heavyweight
+     * detectors must keep their cross-reference state internally
+     * synchronized, which InsiderTradingDetector already does.
+     */
+    template <typename Sink>
+    void run_heavy(const TradeRecord& trade, const HistoricalContext& context, Sink&& sink) {
+        with_profile([&](auto profile) {
+            std::apply([&](auto&... detector) {
+                ((IsHeavyweight<std::decay_t<decltype(detector)>>::value
+                      ? run_one(profile, detector, trade, context, sink)
+                      : void()), ...);
+            }, detectors_);
+        });
+    }
+
+    /**
+     * @brief Enable or disable a built-in by name
+     * @param pattern_name Registered pattern name (e.g. "pump_dump")
+     * @param enabled New enabled state
+     * @return true if the name matched a built-in
+     */
+    bool set_enabled(const std::string& pattern_name, bool enabled) {
+        return for_named(pattern_name, [enabled](auto& detector) {
+            detector.set_enabled(enabled);
+        });
+    }
+
+    /**
+     * @brief Update a built-in's configuration by name
+     * @param pattern_name Registered pattern name
+     * @param config New configuration parameters
+     * @return true if the name matched a built-in
+     */
+    bool update_config(const std::string& pattern_name, const PatternConfig& config) {
+        return for_named(pattern_name, [&config](auto& detector) {
+            detector.update_config(config);
+        });
+    }
+
+    /**
+     * @brief Select the configuration profile for subsequent runs
+     *
+     * Named profiles route every run through the matching constexpr
+     * policy instantiation; update_config() changes are ignored until the
+     * profile returns to kRuntime. Set at initialize(), not per trade.
+     *
+     * @param profile Profile to run under
+     */
+    void set_profile(ConfigProfile profile) {
+        profile_ = profile;
+    }
+
+    /** @brief Currently selected configuration profile */
+    ConfigProfile profile() const {
+        return profile_;
+    }
+
+    /**
+     * @brief Visit every built-in's name (tracer/budget registration)
+     * @param fn Callable (const std::string& name)
+     */
+    template <typename Fn>
+    void for_each_name(Fn&& fn) const {
+        std::apply([&](const auto&... detector) {
+            (fn(detector.get_name()), ...);
+        }, detectors_);
+    }
+
+    /** @brief Number of built-in detectors in the pipeline */
+    static constexpr size_t size() {
+        return std::tuple_size_v<DetectorTuple>;
+    }
+
+private:
+    using DetectorTuple = std::tuple<PumpDumpDetector,
+                                     LayeringDetector,
+                                     WashTradingDetector,
+                                     InsiderTradingDetector,
+                                     FrontRunningDetector>;
+
+    // One switch on the stored profile selects a fully-instantiated static
+    // pipeline body; inside it every threshold is a folded constant. The
+    // switch target never changes after initialize(), so the branch
+    // predictor eats it.
+    template <typename Fn>
+    void with_profile(Fn&& fn) {
+        switch (profile_) {
+            case ConfigProfile::kEquityDefaults:
+                fn(EquityDefaultsProfile{});
+                break;
+            case ConfigProfile::kHighVolume:
+                fn(HighVolumeProfile{});
+                break;
+            default:
+                fn(RuntimeProfile{});
+                break;
+        }
+    }
+
+    // Static profiles take the detect_pattern(trade, context, Profile{})
+    // overload each detector provides alongside its runtime entry point
+    template <typename Profile, typename Detector>
+    static auto detect_one(Profile, Detector& detector, const TradeRecord& trade,
+                           const HistoricalContext& context) {
+        if constexpr (Profile::kStatic) {
+            return detector.detect_pattern(trade, context, Profile{});
+        } else {
+            return detector.detect_pattern(trade, context);
+        }
+    }
+
+    template <typename Profile, typename Detector, typename Sink>
+    void run_one(Profile profile, Detector& detector, const TradeRecord& trade,
+                 const HistoricalContext& context, Sink& sink) {
+        if (!detector.is_enabled()) {
+            return;
+        }
+        auto alert = detect_one(profile, detector, trade, context);
+        if (alert) {
+            sink(detector.get_name(), std::move(*alert));
+        }
+    }
+
+    template <typename Profile, typename Detector, typename Sink, typename Timer>
+    void run_one_traced(Profile profile, Detector& detector, const TradeRecord& trade,
+                        const HistoricalContext& context, Sink& sink, Timer& timer) {
+        if (!detector.is_enabled()) {
+            return;
+        }
+        uint64_t start = read_tsc();
+        auto alert = detect_one(profile, detector, trade, context);
+        timer(detector.get_name(), read_tsc() - start);
+        if (alert) {
+            sink(detector.get_name(), std::move(*alert));
+        }
+    }
+
+    template <typename Action>
+    bool for_named(const std::string& pattern_name, Action&& action) {
+        bool matched = false;
+        std::apply([&](auto&... detector) {
+            ((detector.get_name() == pattern_name
+                  ? (action(detector), matched = true)
+                  : false), ...);
+        }, detectors_);
+        return matched;
+    }
+
+    DetectorTuple detectors_;
+    ConfigProfile profile_ = ConfigProfile::kRuntime;
+};
+
+template <>
+struct BuiltinDetectorPipeline::IsHeavyweight<InsiderTradingDetector> : std::true_type {};
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Selectable detector configuration profiles
+ *
+ * kRuntime keeps the JSON-loaded PatternConfig path: thresholds are
+ * member loads and the comparisons branch on runtime values. The named
+ * profiles are constexpr policies compiled into dedicated pipeline
+ * instantiations - every threshold is a literal the compiler folds into
+ * the comparison, so the common production configurations (unchanged for
+ * a year) pay no config loads and no data-dependent branches. Exotic
+ * settings simply stay on kRuntime.
+ */
+enum class ConfigProfile {
+    kRuntime = 0,
+    kEquityDefaults,
+    kHighVolume
+};
+
+/**
+ * @brief Tag for the runtime-config detector path
+ */
+struct RuntimeProfile {
+    static constexpr bool kStatic = false;
+};
+
+/**
+ * @brief Production thresholds for the equity cash segment
+ *
+ * Mirrors config/surveillance.json as deployed; a threshold change here
+ * must ship with the matching config change so kRuntime and the profile
+ * agree.
+ */
+struct EquityDefaultsProfile {
+    static constexpr bool kStatic = true;
+
+    // Pump & dump
+    static constexpr double kPumpPriceSpikeRatio = 0.05;
+    static constexpr double kPumpVolumeMultiple = 4.0;
+
+    // Layering / spoofing
+    static constexpr double kLayeringImbalanceRatio = 0.8;
+    static constexpr uint32_t kLayeringMinOrders = 5;
+
+    // Wash trading
+    static constexpr double kWashPriceTolerance = 0.001;
+    static constexpr uint32_t kWashWindowSeconds = 300;
+
+    // Insider trading
+    static constexpr double kInsiderVolumeZScore = 3.0;
+
+    // Front running
+    static constexpr uint32_t kFrontRunLeadMillis = 500;
+    static constexpr double kFrontRunSizeRatio = 0.25;
+};
+
+/**
+ * @brief Desensitized thresholds for expiry days and index rebalances
+ *
+ * Same shape as EquityDefaultsProfile with the volume-driven triggers
+ * loosened, so legitimately heavy sessions don't drown the alert lanes.
+ */
+struct HighVolumeProfile {
+    static constexpr bool kStatic = true;
+
+    static constexpr double kPumpPriceSpikeRatio = 0.08;
+    static constexpr double kPumpVolumeMultiple = 8.0;
+
+    static constexpr double kLayeringImbalanceRatio = 0.9;
+    static constexpr uint32_t kLayeringMinOrders = 10;
+
+    static constexpr double kWashPriceTolerance = 0.001;
+    static constexpr uint32_t kWashWindowSeconds = 120;
+
+    static constexpr double kInsiderVolumeZScore = 4.0;
+
+    static constexpr uint32_t kFrontRunLeadMillis = 250;
+    static constexpr double kFrontRunSizeRatio = 0.4;
+};
+
+/**
+ * @brief Parse a profile name from configuration
+ * @param name Profile name ("runtime", "equity_defaults", "high_volume")
+ * @return Matching profile, or empty for unknown names
+ */
+inline std::optional<ConfigProfile> config_profile_from_string(const std::string& name) {
+    if (name == "runtime") {
+        return ConfigProfile::kRuntime;
+    }
+    if (name == "equity_defaults") {
+        return ConfigProfile::kEquityDefaults;
+    }
+    if (name == "high_volume") {
+        return ConfigProfile::kHighVolume;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Human-readable profile name for logs
+ */
+inline const char* config_profile_name(ConfigProfile profile) {
+    switch (profile) {
+        case ConfigProfile::kRuntime:        return "runtime";
+        case ConfigProfile::kEquityDefaults: return "equity_defaults";
+        case ConfigProfile::kHighVolume:     return "high_volume";
+        default:                             return "unknown";
+    }
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
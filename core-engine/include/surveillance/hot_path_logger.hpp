@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dharmaguard {
+namespace surveillance {
+
+enum class LogSeverity : uint8_t {
+    kInfo,
+    kWarn,
+    kError,
+};
+
+/**
+ * @brief Zero-allocation asynchronous logging facade for the hot path
+ *
+ * A direct spdlog call formats the message and touches the sink on the
+ * calling thread, which is exactly wrong inside the detection loop: the
+ * warn-per-dropped-trade storm during a queue-full episode becomes the
+ * bottleneck that keeps the queue full. Hot sites instead write a
+ * fixed-size binary record - timestamp, two integer arguments, one
+ * inline string - into a per-thread SPSC ring; a background formatter
+ * thread drains the rings, renders the registered format strings and
+ * hands the result to the normal spdlog sinks off-path.
+ *
+ * Each site is rate limited at the source: the first N occurrences are
+ * always recorded, then one in every K, with the suppressed remainder
+ * counted and reported periodically by the formatter. Rings drop (and
+ * count) records when full rather than ever blocking a producer.
+ * Control-path logging stays on spdlog directly.
+ */
+class HotPathLogger {
+public:
+    /// Per-thread ring capacity in records; power of two
+    static constexpr size_t kRingCapacity = 4096;
+    /// Inline text capacity per record, including the terminator
+    static constexpr size_t kTextCapacity = 36;
+
+    /**
+     * @brief Per-site rate limiting: first N occurrences, then every Kth
+     */
+    struct SiteOptions {
+        uint64_t first_n = 100;
+        uint64_t every_k = 1000;
+    };
+
+    /**
+     * @brief Facade counters for monitoring
+     */
+    struct Stats {
+        uint64_t records_emitted = 0;
+        uint64_t records_suppressed = 0;
+        uint64_t records_dropped = 0;
+    };
+
+    HotPathLogger();
+    ~HotPathLogger();
+
+    /**
+     * @brief Register a log site before start()
+     *
+     * The format string is rendered by the formatter thread with manual
+     * argument indices: {0} and {1} are the two integer arguments, {2}
+     * is the inline text.
+     *
+     * @param severity Level the rendered message is emitted at
+     * @param format fmt-style format string with {0}/{1}/{2} placeholders
+     * @param options Rate limiting parameters for this site
+     * @return Site ID to pass to log()
+     */
+    uint32_t register_site(LogSeverity severity, std::string format,
+                           SiteOptions options);
+    uint32_t register_site(LogSeverity severity, std::string format);
+
+    /**
+     * @brief Start the background formatter thread
+     * @return true if started successfully
+     */
+    bool start();
+
+    /**
+     * @brief Drain remaining records and stop the formatter thread
+     */
+    void stop();
+
+    /**
+     * @brief Record one occurrence of a site
+     *
+     * Wait-free on the calling thread: a rate-limit check, a timestamp
+     * and a bounded copy into the thread's ring. No formatting, no
+     * allocation, no sink I/O.
+     *
+     * @param site Site ID from register_site()
+     * @param arg0 First integer argument ({0} in the format)
+     * @param arg1 Second integer argument ({1} in the format)
+     * @param text Inline string argument ({2}), truncated at capacity
+     */
+    void log(uint32_t site, uint64_t arg0 = 0, uint64_t arg1 = 0,
+             const char* text = "") {
+        SiteState& state = *sites_[site];
+        uint64_t seq = state.hits.fetch_add(1, std::memory_order_relaxed);
+        if (seq >= state.options.first_n &&
+            seq % state.options.every_k != 0) {
+            state.suppressed.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        LogRecord record;
+        record.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        record.arg0 = arg0;
+        record.arg1 = arg1;
+        record.site = site;
+        size_t length = std::min(std::strlen(text), kTextCapacity - 1);
+        std::memcpy(record.text, text, length);
+        record.text[length] = '\0';
+
+        ring_for_this_thread()->push(record);
+    }
+
+    /**
+     * @brief Current facade statistics
+     * @return Snapshot of the emit/suppress/drop counters
+     */
+    Stats get_stats() const;
+
+private:
+    struct LogRecord {
+        uint64_t timestamp_ns = 0;
+        uint64_t arg0 = 0;
+        uint64_t arg1 = 0;
+        uint32_t site = 0;
+        char text[kTextCapacity] = {};
+    };
+
+    struct SiteState {
+        LogSeverity severity;
+        std::string format;
+        SiteOptions options;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> suppressed{0};
+        /// Suppressed count already reported by the formatter
+        uint64_t reported = 0;
+    };
+
+    /**
+     * @brief SPSC record ring owned by one producer thread
+     */
+    struct alignas(64) ThreadRing {
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        std::atomic<uint64_t> dropped{0};
+        std::array<LogRecord, kRingCapacity> records;
+
+        void push(const LogRecord& record) {
+            uint64_t h = head.load(std::memory_order_relaxed);
+            uint64_t t = tail.load(std::memory_order_acquire);
+            if (h - t >= kRingCapacity) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            records[h & (kRingCapacity - 1)] = record;
+            head.store(h + 1, std::memory_order_release);
+        }
+    };
+
+    ThreadRing* ring_for_this_thread();
+    void formatter_thread_func();
+    void drain_rings();
+    void report_suppressed();
+
+    std::vector<std::unique_ptr<SiteState>> sites_;
+    std::vector<std::unique_ptr<ThreadRing>> rings_;
+    std::mutex rings_mutex_;
+
+    /// Process-wide facade identity; monotonically assigned and never
+    /// reused, so thread-local ring caches cannot be fooled by a new
+    /// logger at a destroyed one's recycled address
+    uint64_t logger_id_ = 0;
+
+    std::thread formatter_thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> records_emitted_{0};
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
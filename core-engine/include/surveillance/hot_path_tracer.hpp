@@ -0,0 +1,248 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Read the CPU timestamp counter
+ *
+ * One instruction on x86, no serialization - cheap enough to bracket
+ * individual pipeline stages. Falls back to the steady clock elsewhere.
+ */
+inline uint64_t read_tsc() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * @brief Pipeline stages bracketed by the tracer
+ */
+enum class TraceStage : uint8_t {
+    kDequeue = 0,       ///< Popping a batch off the worker's queue
+    kContextUpdate,     ///< Context lookup, window fold and graph update
+    kDetector,          ///< One detector's detect_pattern() call
+    kAlertEnqueue,      ///< Handing an alert to the dispatch lanes
+    kStageCount
+};
+
+/**
+ * @brief Sampling trace recorder for the detection hot path
+ *
+ * Workers sample one trade in every sample_rate (power of two, so the
+ * decision is an increment and a mask) and bracket each pipeline stage
+ * with TSC reads, pushing 8-byte samples into a per-worker ring. Nothing
+ * on the hot path formats, locks or allocates; when a ring is full the
+ * sample is dropped and counted. drain() runs off-path on the metrics
+ * cadence, converts cycles to nanoseconds with the calibrated TSC rate,
+ * and aggregates per stage and per detector - including counting samples
+ * that exceeded a detector's time budget, which feeds the per-pattern
+ * throttling in TradePatternDetector.
+ */
+class HotPathTracer {
+public:
+    /// Samples per worker ring; full rings drop rather than block
+    static constexpr size_t kRingCapacity = 4096;
+    /// Detector slots (5 built-ins plus custom plugins); excess goes to slot 0
+    static constexpr size_t kMaxDetectorSlots = 32;
+
+    /**
+     * @brief Aggregated timings for one pipeline stage
+     */
+    struct StageTiming {
+        uint64_t samples = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+    };
+
+    /**
+     * @brief Aggregated timings for one detector
+     */
+    struct DetectorTiming {
+        std::string name;
+        uint64_t samples = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+        uint64_t budget_violations = 0;
+    };
+
+    /**
+     * @brief Snapshot of everything drained so far
+     */
+    struct Report {
+        std::array<StageTiming, static_cast<size_t>(TraceStage::kStageCount)> stages;
+        std::vector<DetectorTiming> detectors;
+        uint64_t dropped_samples = 0;
+        size_t sample_rate = 0;
+    };
+
+    /**
+     * @brief Constructor; calibrates the TSC against the steady clock
+     * @param num_workers Worker thread count (one ring each)
+     * @param sample_rate Trades per sample, rounded up to a power of two
+     */
+    HotPathTracer(size_t num_workers, size_t sample_rate);
+
+    /**
+     * @brief Register a detector for per-detector aggregation (before start)
+     * @param name Detector name as returned by get_name()
+     */
+    void register_detector(const std::string& name);
+
+    /**
+     * @brief Set a detector's per-trade time budget
+     * @param name Registered detector name
+     * @param budget_ns Budget in nanoseconds; 0 disables
+     */
+    void set_budget(const std::string& name, uint64_t budget_ns);
+
+    /**
+     * @brief Decide whether the worker's next trade is sampled
+     *
+     * One increment and one mask on the worker-owned counter; this is the
+     * only tracer cost paid on unsampled trades.
+     */
+    bool should_sample(size_t worker) {
+        return (workers_[worker]->counter++ & sample_mask_) == 0;
+    }
+
+    /**
+     * @brief Record a stage sample (sampled trades only)
+     * @param worker Recording worker index
+     * @param stage Pipeline stage
+     * @param cycles TSC delta for the stage
+     */
+    void record(size_t worker, TraceStage stage, uint64_t cycles) {
+        push(worker, stage, 0, cycles);
+    }
+
+    /**
+     * @brief Record a detector sample (sampled trades only)
+     *
+     * Resolves the name against the registry - a scan over a handful of
+     * entries, paid once per sampled trade per detector.
+     */
+    void record_detector(size_t worker, const std::string& name, uint64_t cycles) {
+        uint8_t slot = 0;
+        for (size_t i = 0; i < detector_names_.size(); ++i) {
+            if (detector_names_[i] == name) {
+                slot = static_cast<uint8_t>(i + 1);
+                break;
+            }
+        }
+        push(worker, TraceStage::kDetector, slot, cycles);
+    }
+
+    /**
+     * @brief Consume all worker rings and fold into the aggregates
+     *
+     * Called off-path (metrics thread); safe to run concurrently with the
+     * workers, each ring is single-producer single-consumer.
+     */
+    void drain();
+
+    /**
+     * @brief Snapshot of the aggregates accumulated so far
+     * @return Per-stage and per-detector timings
+     */
+    Report report() const;
+
+    /**
+     * @brief Budget violations per detector since the last call
+     * @return (name, violation count) pairs, violating detectors only
+     */
+    std::vector<std::pair<std::string, uint64_t>> take_budget_violations();
+
+    /** @brief Configured trades-per-sample rate */
+    size_t sample_rate() const { return sample_mask_ + 1; }
+
+private:
+    // 8 bytes; cycles saturate at ~4G, more than a second of stage time
+    struct TraceSample {
+        uint32_t cycles;
+        uint8_t stage;
+        uint8_t slot;
+        uint16_t reserved;
+    };
+
+    // Single-producer (the worker) / single-consumer (drain) ring plus the
+    // worker's sampling counter, padded against neighbouring workers
+    struct alignas(64) WorkerState {
+        uint64_t counter = 0;
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        std::atomic<uint64_t> dropped{0};
+        std::array<TraceSample, kRingCapacity> ring;
+    };
+
+    struct DetectorAgg {
+        uint64_t samples = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+        uint64_t budget_violations = 0;
+        uint64_t violations_since_take = 0;
+    };
+
+    void push(size_t worker, TraceStage stage, uint8_t slot, uint64_t cycles) {
+        WorkerState& state = *workers_[worker];
+        uint64_t head = state.head.load(std::memory_order_relaxed);
+        if (head - state.tail.load(std::memory_order_acquire) >= kRingCapacity) {
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        TraceSample& sample = state.ring[head & (kRingCapacity - 1)];
+        sample.cycles = cycles > UINT32_MAX
+            ? UINT32_MAX : static_cast<uint32_t>(cycles);
+        sample.stage = static_cast<uint8_t>(stage);
+        sample.slot = slot;
+        state.head.store(head + 1, std::memory_order_release);
+    }
+
+    static double measure_cycles_per_ns();
+
+    size_t sample_mask_;
+    double cycles_per_ns_;
+    std::vector<std::unique_ptr<WorkerState>> workers_;
+
+    // Registry is written before start() and read-only afterwards
+    std::vector<std::string> detector_names_;
+    std::vector<uint64_t> budgets_ns_;
+
+    // Aggregates are written by drain() and read by report(); both run
+    // off-path, the mutex never touches the workers
+    mutable std::mutex agg_mutex_;
+    std::array<StageTiming, static_cast<size_t>(TraceStage::kStageCount)> stage_aggs_{};
+    std::vector<DetectorAgg> detector_aggs_;
+};
+
+/**
+ * @brief Human-readable stage name for reports
+ */
+inline const char* trace_stage_name(TraceStage stage) {
+    switch (stage) {
+        case TraceStage::kDequeue:       return "dequeue";
+        case TraceStage::kContextUpdate: return "context_update";
+        case TraceStage::kDetector:      return "detector";
+        case TraceStage::kAlertEnqueue:  return "alert_enqueue";
+        default:                         return "unknown";
+    }
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
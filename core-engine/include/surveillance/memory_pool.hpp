@@ -0,0 +1,216 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <boost/lockfree/stack.hpp>
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Tiered object pool: per-thread slab caches over a central arena
+ *
+ * Each thread gets a small per-pool cache of objects refilled from (and
+ * returned to) the central lock-free arena in batches, so the common-case
+ * allocate()/deallocate() touches no shared state at all and the central
+ * free list is only hit once per kCacheBatch operations. The caches are
+ * owned by the pool and indexed from thread-local state by a process-wide
+ * pool ID that is never reused, so neither pool destruction nor a new
+ * pool at a recycled address can ever surface another pool's cached
+ * pointers, and a thread working across several pools (the per-NUMA-node
+ * layout) keeps an independent cache for each. When the arena is
+ * exhausted a bounded overflow tier falls back to the heap instead of
+ * dropping trades, and a high-watermark counter plus overflow statistics
+ * expose pool pressure to monitoring.
+ */
+template <typename T>
+class MemoryPool {
+public:
+    /// Objects moved between a thread cache and the central arena per refill
+    static constexpr size_t kCacheBatch = 64;
+
+    /**
+     * @brief Construct a pool with a fixed central arena
+     * @param capacity Number of objects pre-allocated in the central arena
+     * @param overflow_capacity Maximum additional heap objects permitted
+     *        when the arena is exhausted (0 disables the overflow tier)
+     */
+    explicit MemoryPool(size_t capacity, size_t overflow_capacity = 0)
+        : capacity_(capacity)
+        , overflow_capacity_(overflow_capacity)
+        , storage_(std::make_unique<T[]>(capacity))
+        , free_list_(capacity)
+    {
+        for (size_t i = 0; i < capacity_; ++i) {
+            free_list_.push(&storage_[i]);
+        }
+    }
+
+    /**
+     * @brief Take an object, preferring the calling thread's cache
+     * @return Pooled or overflow object, or nullptr if both tiers are
+     *         exhausted
+     */
+    T* allocate() {
+        ThreadCache& cache = local_cache();
+
+        if (cache.objects.empty() && !refill_cache(cache)) {
+            return allocate_overflow();
+        }
+
+        T* object = cache.objects.back();
+        cache.objects.pop_back();
+        return object;
+    }
+
+    /**
+     * @brief Return an object to the calling thread's cache
+     * @param object Pointer previously obtained from allocate()
+     */
+    void deallocate(T* object) {
+        if (!object) {
+            return;
+        }
+
+        if (!owns(object)) {
+            delete object;
+            overflow_in_use_.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+
+        ThreadCache& cache = local_cache();
+        cache.objects.push_back(object);
+
+        // Cap the cache at two batches; return a full batch to the arena
+        // so bursty threads do not strand the whole pool locally
+        if (cache.objects.size() >= 2 * kCacheBatch) {
+            flush_batch(cache);
+        }
+    }
+
+    /** @brief Total number of objects in the central arena */
+    size_t capacity() const { return capacity_; }
+
+    /** @brief Peak number of arena objects handed out to thread caches */
+    size_t high_watermark() const {
+        return high_watermark_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Total allocations served by the heap overflow tier */
+    uint64_t overflow_allocations() const {
+        return overflow_allocations_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct ThreadCache {
+        std::vector<T*> objects;
+    };
+
+    /// Process-wide pool identity; monotonically assigned and never
+    /// reused, unlike a pool's address
+    static uint64_t next_pool_id() {
+        static std::atomic<uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    ThreadCache& local_cache() {
+        struct Slot {
+            uint64_t pool_id;
+            ThreadCache* cache;
+        };
+        static thread_local std::vector<Slot> slots;
+
+        for (const Slot& slot : slots) {
+            if (slot.pool_id == pool_id_) {
+                return *slot.cache;
+            }
+        }
+
+        // First use of this pool on this thread. The cache is owned by
+        // the pool (and freed with it); the TLS slot only indexes it by
+        // ID, so a slot left behind by a destroyed pool is dead weight
+        // that can never be matched again, not a dangling dereference.
+        auto cache = std::make_unique<ThreadCache>();
+        cache->objects.reserve(2 * kCacheBatch);
+        ThreadCache* raw = cache.get();
+        {
+            std::lock_guard<std::mutex> lock(caches_mutex_);
+            caches_.push_back(std::move(cache));
+        }
+        slots.push_back({pool_id_, raw});
+        return *raw;
+    }
+
+    bool refill_cache(ThreadCache& cache) {
+        size_t taken = 0;
+        T* object = nullptr;
+        while (taken < kCacheBatch && free_list_.pop(object)) {
+            cache.objects.push_back(object);
+            ++taken;
+        }
+
+        if (taken == 0) {
+            return false;
+        }
+
+        size_t outstanding = arena_taken_.fetch_add(taken, std::memory_order_relaxed) + taken;
+        size_t watermark = high_watermark_.load(std::memory_order_relaxed);
+        while (outstanding > watermark &&
+               !high_watermark_.compare_exchange_weak(watermark, outstanding,
+                                                      std::memory_order_relaxed)) {
+            // Retry until recorded or no longer the peak
+        }
+        return true;
+    }
+
+    void flush_batch(ThreadCache& cache) {
+        for (size_t i = 0; i < kCacheBatch; ++i) {
+            free_list_.push(cache.objects.back());
+            cache.objects.pop_back();
+        }
+        arena_taken_.fetch_sub(kCacheBatch, std::memory_order_relaxed);
+    }
+
+    T* allocate_overflow() {
+        if (overflow_capacity_ == 0) {
+            return nullptr;
+        }
+
+        uint64_t in_use = overflow_in_use_.fetch_add(1, std::memory_order_relaxed);
+        if (in_use >= overflow_capacity_) {
+            overflow_in_use_.fetch_sub(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        overflow_allocations_.fetch_add(1, std::memory_order_relaxed);
+        return new T();
+    }
+
+    bool owns(const T* object) const {
+        return object >= storage_.get() && object < storage_.get() + capacity_;
+    }
+
+    size_t capacity_;
+    size_t overflow_capacity_;
+    std::unique_ptr<T[]> storage_;
+    boost::lockfree::stack<T*> free_list_;
+
+    // Per-thread caches, owned here so they die with the pool; the mutex
+    // only guards registration of a thread's first use
+    const uint64_t pool_id_ = next_pool_id();
+    std::mutex caches_mutex_;
+    std::vector<std::unique_ptr<ThreadCache>> caches_;
+
+    // Pool pressure metrics, batch-granular so the hot path stays cheap
+    std::atomic<size_t> arena_taken_{0};
+    std::atomic<size_t> high_watermark_{0};
+    std::atomic<uint64_t> overflow_in_use_{0};
+    std::atomic<uint64_t> overflow_allocations_{0};
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Top-of-book snapshot for one instrument
+ */
+struct TopOfBook {
+    double bid_price = 0.0;
+    double ask_price = 0.0;
+    uint64_t bid_quantity = 0;
+    uint64_t ask_quantity = 0;
+    int64_t timestamp_ns = 0;
+};
+
+/**
+ * @brief One quote update at the ingestion boundary, pre-interning
+ */
+struct QuoteUpdate {
+    std::string instrument_symbol;
+    TopOfBook top;
+};
+
+/**
+ * @brief Lock-free per-instrument top-of-book table with seqlock reads
+ *
+ * Slots are cache-line aligned and indexed directly by interned
+ * instrument ID, so the context-build step reads an instrument's quote
+ * in a few nanoseconds with no shared cache-line traffic between
+ * instruments. Each slot is a seqlock: the single quote-consumer thread
+ * bumps the sequence to odd, writes the fields and bumps it even;
+ * readers retry on an odd or changed sequence, so a torn read is never
+ * observed and readers never block the writer. Keeping quotes
+ * in-process replaces the per-trade Redis round-trip the enrichment
+ * prototype needed.
+ */
+class QuoteTable {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Slot count; interned IDs at or past it are dropped
+     */
+    explicit QuoteTable(size_t capacity = 1 << 18)
+        : slots_(capacity)
+    {
+    }
+
+    /**
+     * @brief Publish a quote (single writer per instrument)
+     * @param instrument_id Interned instrument ID
+     * @param top New top-of-book values
+     */
+    void update(uint32_t instrument_id, const TopOfBook& top) {
+        if (instrument_id >= slots_.size()) {
+            capacity_misses_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        Slot& slot = slots_[instrument_id];
+
+        uint32_t seq = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(seq + 1, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.top = top;
+
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.sequence.store(seq + 2, std::memory_order_release);
+        updates_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Read an instrument's quote without blocking the writer
+     * @param instrument_id Interned instrument ID
+     * @param out Receives a consistent snapshot on success
+     * @return true if a quote has been published for the instrument
+     */
+    bool read(uint32_t instrument_id, TopOfBook& out) const {
+        if (instrument_id >= slots_.size()) {
+            return false;
+        }
+        const Slot& slot = slots_[instrument_id];
+
+        uint32_t before;
+        do {
+            before = slot.sequence.load(std::memory_order_acquire);
+            if (before == 0) {
+                // Never written
+                read_misses_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (before & 1) {
+                // Writer mid-update; the copy below would tear
+                continue;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            out = slot.top;
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while (slot.sequence.load(std::memory_order_acquire) != before);
+
+        return true;
+    }
+
+    /** @brief Quotes published */
+    uint64_t updates() const {
+        return updates_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Reads for instruments with no quote yet */
+    uint64_t read_misses() const {
+        return read_misses_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Updates dropped for IDs past the table capacity */
+    uint64_t capacity_misses() const {
+        return capacity_misses_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Slot count */
+    size_t capacity() const { return slots_.size(); }
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<uint32_t> sequence{0};
+        TopOfBook top;
+    };
+
+    std::vector<Slot> slots_;
+    std::atomic<uint64_t> updates_{0};
+    mutable std::atomic<uint64_t> read_misses_{0};
+    std::atomic<uint64_t> capacity_misses_{0};
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
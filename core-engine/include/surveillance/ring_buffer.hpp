@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Fixed-capacity ring buffer for sliding-window trade history
+ *
+ * Replaces the std::vector + remove_if sliding windows in
+ * HistoricalContext: expired entries are popped from the front and new
+ * entries pushed at the back, so window maintenance is O(expired) per
+ * trade instead of O(window), with no reallocation after construction.
+ * Single-threaded by design - each context shard is owned by one worker.
+ */
+template <typename T>
+class RingBuffer {
+public:
+    static constexpr size_t kDefaultCapacity = 4096;
+
+    explicit RingBuffer(size_t capacity = kDefaultCapacity)
+        : buffer_(round_up_pow2(capacity))
+        , mask_(buffer_.size() - 1)
+    {
+    }
+
+    /**
+     * @brief Append an element; the caller must evict when full
+     * @param value Element to append
+     */
+    void push_back(const T& value) {
+        buffer_[(head_ + count_) & mask_] = value;
+        ++count_;
+    }
+
+    /** @brief Remove the oldest element */
+    void pop_front() {
+        head_ = (head_ + 1) & mask_;
+        --count_;
+    }
+
+    /** @brief Oldest element in the window */
+    const T& front() const { return buffer_[head_]; }
+
+    /** @brief Newest element in the window */
+    const T& back() const { return buffer_[(head_ + count_ - 1) & mask_]; }
+
+    /**
+     * @brief Indexed access, 0 = oldest
+     * @param index Position within the window
+     */
+    const T& operator[](size_t index) const {
+        return buffer_[(head_ + index) & mask_];
+    }
+
+    /** @brief Drop all elements; capacity is retained */
+    void clear() {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    size_t size() const { return count_; }
+    size_t capacity() const { return buffer_.size(); }
+    bool empty() const { return count_ == 0; }
+    bool full() const { return count_ == buffer_.size(); }
+
+private:
+    static size_t round_up_pow2(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    std::vector<T> buffer_;
+    size_t mask_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
+/**
+ * @brief O(1) incremental aggregates over a sliding trade window
+ *
+ * Maintains running sums so avg_volume, avg_price and price_volatility
+ * never need to be recomputed by scanning the window. Removal support
+ * (for expiring trades) uses sum-of-squares rather than Welford, which is
+ * numerically adequate for our bounded 5-minute windows.
+ */
+struct RollingStats {
+    void add(double price, double quantity) {
+        ++count;
+        price_sum += price;
+        price_sq_sum += price * price;
+        volume_sum += quantity;
+    }
+
+    void remove(double price, double quantity) {
+        --count;
+        price_sum -= price;
+        price_sq_sum -= price * price;
+        volume_sum -= quantity;
+    }
+
+    double avg_price() const {
+        return count > 0 ? price_sum / static_cast<double>(count) : 0.0;
+    }
+
+    double avg_volume() const {
+        return count > 0 ? volume_sum / static_cast<double>(count) : 0.0;
+    }
+
+    double price_volatility() const {
+        if (count < 2) {
+            return 0.0;
+        }
+        double mean = price_sum / static_cast<double>(count);
+        double variance = price_sq_sum / static_cast<double>(count) - mean * mean;
+        return variance > 0.0 ? std::sqrt(variance) : 0.0;
+    }
+
+    uint64_t count = 0;
+    double price_sum = 0.0;
+    double price_sq_sum = 0.0;
+    double volume_sum = 0.0;
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "surveillance/trade_pattern_detector.hpp"
+
+namespace dharmaguard {
+namespace surveillance {
+namespace simd {
+
+/**
+ * @brief Range limits applied by the batch validator
+ *
+ * Everything is a plain numeric bound so the checks compile to masked
+ * compares across lanes. The timestamp window bounds default to 0 =
+ * disabled, because the replay path feeds historical tapes whose
+ * timestamps are legitimately old.
+ */
+struct ValidationLimits {
+    /// Price must be strictly above this
+    double min_price = 0.0;
+    /// Price must be strictly below this
+    double max_price = 1e8;
+    /// Quantity must be at least this
+    double min_quantity = 1.0;
+    /// Quantity must be at most this
+    double max_quantity = 1e10;
+    /// Reject timestamps further than this ahead of now (0 = disabled)
+    int64_t max_future_skew_ns = 0;
+    /// Reject timestamps older than this (0 = disabled)
+    int64_t max_age_ns = 0;
+};
+
+/**
+ * @brief Structure-of-arrays staging of a record batch for validation
+ *
+ * Same pattern as WindowSnapshot: the validator kernels run over
+ * contiguous price/quantity/timestamp columns at full SIMD width instead
+ * of striding over TradeRecords. Reused per ingest thread, so the
+ * vectors only grow.
+ */
+struct ValidationColumns {
+    std::vector<double> prices;
+    std::vector<double> quantities;
+    std::vector<int64_t> timestamps_ns;
+
+    /**
+     * @brief Rebuild the columns from a record batch
+     * @param records Contiguous record array
+     * @param count Number of records
+     */
+    void assign(const TradeRecord* records, size_t count);
+
+    size_t size() const { return prices.size(); }
+};
+
+/**
+ * @brief Branchless range validation over a staged batch
+ *
+ * Every element is checked against the limits with mask arithmetic - no
+ * data-dependent branches, no logging; callers count and report
+ * rejections in aggregate. Dispatches at runtime to an AVX-512, AVX2 or
+ * scalar kernel; all variants produce identical results.
+ *
+ * @param columns Staged batch columns
+ * @param limits Range limits
+ * @param now_ns Current wall time, for the optional timestamp window
+ * @param valid Output array of 0/1 flags, one per element
+ * @return Number of valid elements
+ */
+size_t validate_batch(const ValidationColumns& columns, const ValidationLimits& limits,
+                      int64_t now_ns, uint8_t* valid);
+
+/**
+ * @brief Name of the validator kernel selected at process start
+ * @return "avx512", "avx2" or "scalar"
+ */
+const char* validator_kernel_name();
+
+} // namespace simd
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "surveillance/ring_buffer.hpp"
+#include "surveillance/trade_pattern_detector.hpp"
+
+namespace dharmaguard {
+namespace surveillance {
+namespace simd {
+
+/**
+ * @brief Structure-of-arrays snapshot of a sliding trade window
+ *
+ * Detector kernels operate on separate contiguous price/quantity/timestamp
+ * arrays rather than striding over TradeRecords, which is what lets the
+ * vectorized kernels below run at full SIMD width. Snapshots are reused
+ * across trades by the owning worker thread, so the vectors only grow.
+ */
+struct WindowSnapshot {
+    std::vector<double> prices;
+    std::vector<double> quantities;
+    std::vector<int64_t> timestamps_ns;
+
+    /**
+     * @brief Rebuild the snapshot from a ring-buffer window
+     * @param window Current instrument or account window
+     */
+    void assign(const RingBuffer<TradeRecord>& window);
+
+    size_t size() const { return prices.size(); }
+};
+
+/**
+ * @brief Aggregates produced by a single pass over a window snapshot
+ */
+struct WindowStats {
+    double min = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+    double stddev = 0.0;
+    double vwap = 0.0;
+};
+
+/**
+ * @brief Compute min/max/mean/stddev/VWAP over a price window in one pass
+ *
+ * Dispatches at runtime to an AVX-512, AVX2 or scalar kernel depending on
+ * host capabilities; all variants produce identical results.
+ *
+ * @param prices Contiguous price array
+ * @param quantities Contiguous quantity array (same length)
+ * @param count Number of elements
+ * @return Aggregated window statistics
+ */
+WindowStats compute_window_stats(const double* prices, const double* quantities,
+                                 size_t count);
+
+/**
+ * @brief Count elements strictly above a threshold
+ * @param values Contiguous value array
+ * @param count Number of elements
+ * @param threshold Comparison threshold
+ * @return Number of crossings
+ */
+size_t count_above(const double* values, size_t count, double threshold);
+
+/**
+ * @brief Count elements strictly below a threshold
+ * @param values Contiguous value array
+ * @param count Number of elements
+ * @param threshold Comparison threshold
+ * @return Number of crossings
+ */
+size_t count_below(const double* values, size_t count, double threshold);
+
+/**
+ * @brief Name of the kernel variant selected at process start
+ * @return "avx512", "avx2" or "scalar"
+ */
+const char* active_kernel_name();
+
+} // namespace simd
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <tbb/concurrent_unordered_map.h>
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Global interning table mapping identifier strings to dense 32-bit IDs
+ *
+ * Bounded-cardinality identifiers (instrument symbols, account/client IDs,
+ * exchanges, trader IDs) are interned once at the ingestion boundary so the
+ * hot processing path can operate on fixed-size POD records without any
+ * per-trade heap allocation. Interning is thread-safe; resolving an already
+ * interned ID back to its string form is lock-free.
+ */
+class StringInterner {
+public:
+    /// Reserved ID returned for empty strings and unknown lookups
+    static constexpr uint32_t kInvalidId = 0;
+
+    /**
+     * @brief Access the process-wide interner instance
+     * @return Singleton interner shared by all pipeline stages
+     */
+    static StringInterner& instance();
+
+    /**
+     * @brief Intern a string and return its stable 32-bit ID
+     * @param value String to intern (empty maps to kInvalidId)
+     * @return Dense ID valid for the lifetime of the process
+     */
+    uint32_t intern(std::string_view value);
+
+    /**
+     * @brief Resolve an interned ID back to its string form
+     * @param id Previously returned interned ID
+     * @return Interned string, or empty string for kInvalidId / unknown IDs
+     */
+    const std::string& resolve(uint32_t id) const;
+
+    /**
+     * @brief Number of distinct strings interned so far
+     * @return Current table size
+     */
+    size_t size() const;
+
+private:
+    StringInterner();
+
+    // Maximum distinct identifiers; sized for the symbol and account universe
+    // of the largest exchanges we supervise. Fixed so strings_ never
+    // reallocates and resolve() stays safe without a lock.
+    static constexpr size_t kMaxEntries = 1u << 22;
+
+    // Forward map; node-based, so key addresses are stable
+    tbb::concurrent_unordered_map<std::string, uint32_t> ids_;
+
+    // Reverse map indexed by (id - 1); entries point at map keys
+    std::vector<const std::string*> strings_;
+    std::atomic<uint32_t> next_id_{1};
+    std::mutex append_mutex_;
+
+    static const std::string empty_string_;
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Probabilistic seen-set for duplicate trade suppression
+ *
+ * Kafka redelivers trades on consumer rebalance, and each duplicate
+ * otherwise costs a full detection pass and sometimes a duplicate alert.
+ * The deduper is a fixed hash-addressed fingerprint table: the trade_id
+ * hash picks a slot, the full 64-bit hash is the stored fingerprint. A
+ * matching fingerprint means duplicate; a mismatch overwrites the slot,
+ * so old entries age out by displacement and memory stays bounded at
+ * 8 bytes per slot. Misses are possible when two IDs contend for a slot
+ * between redeliveries - a missed duplicate just repeats detection work,
+ * which is the status quo - and false positives require a full 64-bit
+ * hash collision. Slots are relaxed atomics, safe across ingest threads.
+ */
+class TradeDeduper {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Slot count, rounded up to a power of two
+     */
+    explicit TradeDeduper(size_t capacity = 1 << 20)
+        : slots_(std::bit_ceil(std::max<size_t>(capacity, 1024)))
+        , mask_(slots_.size() - 1)
+    {
+    }
+
+    /**
+     * @brief Test and remember a trade ID
+     * @param trade_id NUL-terminated trade identifier
+     * @return true if the ID was (probably) seen before
+     */
+    bool check_and_insert(const char* trade_id) {
+        uint64_t hash = hash_id(trade_id);
+        std::atomic<uint64_t>& slot = slots_[hash & mask_];
+
+        if (slot.load(std::memory_order_relaxed) == hash) {
+            duplicates_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        slot.store(hash, std::memory_order_relaxed);
+        return false;
+    }
+
+    /** @brief Duplicates suppressed so far */
+    uint64_t duplicates() const {
+        return duplicates_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Slot count */
+    size_t capacity() const { return slots_.size(); }
+
+private:
+    // FNV-1a over the inline ID bytes; zero maps to one so an empty slot
+    // can never match
+    static uint64_t hash_id(const char* id) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (const char* p = id; *p != '\0'; ++p) {
+            hash ^= static_cast<uint8_t>(*p);
+            hash *= 1099511628211ULL;
+        }
+        return hash == 0 ? 1 : hash;
+    }
+
+    std::vector<std::atomic<uint64_t>> slots_;
+    size_t mask_;
+    std::atomic<uint64_t> duplicates_{0};
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
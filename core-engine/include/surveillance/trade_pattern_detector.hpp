@@ -17,13 +17,305 @@
 #include "trade_data.hpp"
 #include "pattern_config.hpp"
 #include "surveillance_alert.hpp"
+#include "detector_profiles.hpp"
+#include "hot_path_tracer.hpp"
+#include "latency_histogram.hpp"
+#include "memory_pool.hpp"
+#include "quote_table.hpp"
+#include "ring_buffer.hpp"
+#include "string_interner.hpp"
+#include "wait_strategy.hpp"
 
 namespace dharmaguard {
 namespace surveillance {
 
+/**
+ * @brief Processing statistics structure
+ */
+struct ProcessingStats {
+    uint64_t total_trades_processed = 0;
+    uint64_t total_alerts_generated = 0;
+    uint64_t queue_size = 0;
+    uint64_t avg_processing_time_ns = 0;
+    uint64_t peak_processing_time_ns = 0;
+
+    // Tail latency of per-trade detection, aggregated from the per-worker
+    // latency histograms
+    uint64_t p50_processing_time_ns = 0;
+    uint64_t p99_processing_time_ns = 0;
+    uint64_t p999_processing_time_ns = 0;
+
+    double throughput_trades_per_second = 0.0;
+    double cpu_utilization_percent = 0.0;
+    uint64_t memory_usage_bytes = 0;
+
+    // Context store health: occupied fraction across shards and how many
+    // live contexts LRU pressure has displaced (a sizing signal)
+    double context_store_occupancy = 0.0;
+    uint64_t context_lru_evictions = 0;
+
+    // Alert lane depths and how many low-severity alerts load-shedding
+    // has collapsed into summaries
+    uint64_t alert_high_lane_depth = 0;
+    uint64_t alert_low_lane_depth = 0;
+    uint64_t alerts_collapsed = 0;
+
+    // Ingress hygiene: batch-validator rejections and Kafka redeliveries
+    // the deduper suppressed before they cost a detection pass
+    uint64_t trades_rejected = 0;
+    uint64_t duplicates_suppressed = 0;
+
+    // End-to-end residency measured from the monotonic ingress stamp:
+    // receive-to-dequeue covers the Kafka handoff plus shard queue wait,
+    // receive-to-dispatch runs through detection and the alert lanes
+    uint64_t ingress_to_dequeue_p50_ns = 0;
+    uint64_t ingress_to_dequeue_p99_ns = 0;
+    uint64_t ingress_to_dispatch_p50_ns = 0;
+    uint64_t ingress_to_dispatch_p99_ns = 0;
+    std::chrono::system_clock::time_point last_updated;
+
+    // Per-pattern statistics
+    std::unordered_map<std::string, uint64_t> pattern_alerts_count;
+    std::unordered_map<std::string, uint64_t> pattern_processing_time_ns;
+};
+
+/**
+ * @brief Trade data structure used at the ingestion and reporting boundary
+ *
+ * This is the string-based external representation. The processing pipeline
+ * converts it to the fixed-size TradeRecord at ingress and only converts
+ * back when an alert or report needs human-readable identifiers.
+ */
+struct TradeData {
+    // Core trade information
+    std::string trade_id;
+    std::string instrument_symbol;
+    std::string account_id;
+    std::string client_id;
+
+    // Trade details
+    enum class TradeType { BUY, SELL, SHORT_SELL, COVER } trade_type;
+    enum class MarketSegment { EQUITY, FUTURES, OPTIONS, COMMODITY, CURRENCY } segment;
+
+    uint64_t quantity;
+    double price;
+    double value;
+    std::string exchange;
+    std::chrono::system_clock::time_point timestamp;
+
+    // Extended information for surveillance
+    std::string order_id;
+    std::string trader_id;
+    bool is_own_account;
+    double brokerage;
+    double taxes;
+
+    // Monotonic receive timestamp (steady_clock ns), stamped by the
+    // ingestion boundary; 0 means "not stamped yet" and the conversion to
+    // TradeRecord stamps it at that point instead
+    int64_t ingress_ns = 0;
+
+    // Performance optimization: avoid string allocations
+    uint32_t instrument_id_hash;
+    uint32_t account_id_hash;
+    uint32_t client_id_hash;
+
+    // Validation
+    bool is_valid() const {
+        return !trade_id.empty() &&
+               !instrument_symbol.empty() &&
+               quantity > 0 &&
+               price > 0.0 &&
+               value > 0.0;
+    }
+};
+
+/**
+ * @brief Fixed-size POD trade record for the hot processing path
+ *
+ * Mirror of TradeData with every string member replaced by either an inline
+ * character array (per-trade unique IDs that would bloat an interning table)
+ * or a 32-bit ID backed by the global StringInterner (bounded-cardinality
+ * identifiers). Copying a TradeRecord is a single memcpy with zero heap
+ * allocations, so the lock-free queue, the MemoryPool and every pattern
+ * detector operate exclusively on this layout.
+ */
+struct TradeRecord {
+    /// Inline capacity for per-trade unique identifiers (NUL-terminated)
+    static constexpr size_t kInlineIdCapacity = 24;
+
+    // Per-trade unique identifiers, kept inline rather than interned
+    char trade_id[kInlineIdCapacity];
+    char order_id[kInlineIdCapacity];
+
+    // Interned identifiers (resolve via StringInterner at the alert boundary)
+    uint32_t instrument_id;
+    uint32_t account_id;
+    uint32_t client_id;
+    uint32_t exchange_id;
+    uint32_t trader_id;
+
+    // Trade details
+    TradeData::TradeType trade_type;
+    TradeData::MarketSegment segment;
+
+    uint64_t quantity;
+    double price;
+    double value;
+    std::chrono::system_clock::time_point timestamp;
+
+    bool is_own_account;
+    double brokerage;
+    double taxes;
+
+    // Monotonic receive timestamp carried from the ingestion boundary so
+    // every downstream stage can report residency against the same clock
+    int64_t ingress_ns;
+};
+
+/**
+ * @brief Monotonic clock used for ingress stamping and residency math
+ * @return steady_clock time in nanoseconds
+ */
+inline int64_t ingress_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Convert a boundary TradeData into a pooled TradeRecord in place
+ * @param trade External string-based trade
+ * @param record Destination record (typically from the MemoryPool)
+ */
+void make_trade_record(const TradeData& trade, TradeRecord& record);
+
+/**
+ * @brief Convert a TradeRecord back to its string form for alerts/reporting
+ * @param record Internal POD record
+ * @return Fully populated TradeData with resolved identifier strings
+ */
+TradeData to_trade_data(const TradeRecord& record);
+
+/**
+ * @brief Historical context for pattern detection
+ *
+ * Sliding windows are fixed-capacity ring buffers updated in place, and
+ * the volume/price statistics are O(1) incremental aggregates maintained
+ * by add_trade() - nothing here is recomputed by scanning the window.
+ */
+struct HistoricalContext {
+    // Time window configuration
+    std::chrono::minutes lookback_window{5};
+
+    // Recent trades for the same instrument
+    RingBuffer<TradeRecord> recent_trades;
+
+    // Volume and price statistics (updated incrementally by add_trade)
+    double avg_volume = 0.0;
+    double avg_price = 0.0;
+    double price_volatility = 0.0;
+
+    // Market data
+    double bid_price = 0.0;
+    double ask_price = 0.0;
+    uint64_t bid_quantity = 0;
+    uint64_t ask_quantity = 0;
+
+    // Account-specific history
+    RingBuffer<TradeRecord> account_recent_trades;
+    double account_total_volume = 0.0;
+
+    // Cross-references (legacy flat lists; superseded by account_graph)
+    std::vector<std::string> related_accounts;
+    std::vector<std::string> related_instruments;
+
+    // Process-wide relationship index: same-cluster and k-hop queries over
+    // interned account/instrument IDs in microseconds. Set by the worker
+    // before detectors run; never null inside detect_pattern().
+    class AccountGraph* account_graph = nullptr;
+
+    /**
+     * @brief Fold a trade into the window and refresh the aggregates
+     *
+     * Expires entries older than the lookback window from the front of
+     * the rings, subtracting them from the rolling statistics, then
+     * appends the new trade - O(1) amortized per trade.
+     *
+     * @param trade Trade to fold into the context
+     */
+    void add_trade(const TradeRecord& trade);
+
+    /**
+     * @brief Return the context to its freshly-constructed state
+     *
+     * Used when a ContextStore slot is recycled for a new
+     * (instrument, account) pair; ring capacity is retained.
+     */
+    void reset();
+
+private:
+    RollingStats instrument_stats_;
+};
+
+/**
+ * @brief How detector work is scheduled relative to the worker threads
+ *
+ * kInline runs every detector on the owning worker - the fastest mode for
+ * our built-in set, where per-trade detector work is far smaller than TBB
+ * task-spawn overhead. kOffloadHeavy additionally batches trades destined
+ * for heavyweight detectors (insider_trading cross-reference scans) onto
+ * a dedicated work-stealing pool at a granularity of many trades per task.
+ */
+enum class DetectorExecutionMode {
+    kInline,
+    kOffloadHeavy
+};
+
+/**
+ * @brief Interface for pattern detector implementations
+ */
+class IPatternDetector {
+public:
+    virtual ~IPatternDetector() = default;
+
+    /**
+     * @brief Detect pattern in trade data
+     * @param trade Current trade to analyze (POD hot-path record)
+     * @param historical_context Historical data for context
+     * @return Optional alert if pattern detected
+     */
+    virtual std::optional<SurveillanceAlert> detect_pattern(
+        const TradeRecord& trade,
+        const HistoricalContext& historical_context) = 0;
+
+    /**
+     * @brief Update detector configuration
+     * @param config New configuration parameters
+     */
+    virtual void update_config(const PatternConfig& config) = 0;
+
+    /**
+     * @brief Get detector name
+     * @return String identifier for the detector
+     */
+    virtual std::string get_name() const = 0;
+
+    /**
+     * @brief Check if detector is enabled
+     * @return true if detector is active
+     */
+    virtual bool is_enabled() const = 0;
+
+    /**
+     * @brief Enable or disable the detector
+     * @param enabled New enabled state
+     */
+    virtual void set_enabled(bool enabled) = 0;
+};
+
 /**
  * @brief High-performance trade pattern detection engine
- * 
+ *
  * This class implements a multi-threaded, lock-free pattern detection system
  * capable of processing millions of trades per second with sub-microsecond
  * latency for individual pattern checks.
@@ -37,7 +329,7 @@ public:
      */
     explicit TradePatternDetector(size_t num_threads = std::thread::hardware_concurrency(),
                                 size_t queue_size = 1000000);
-    
+
     /**
      * @brief Destructor - ensures clean shutdown
      */
@@ -63,6 +355,11 @@ public:
 
     /**
      * @brief Process a single trade for pattern detection
+     *
+     * Interns the trade's identifiers, copies it into a pooled TradeRecord
+     * and dispatches it to the worker shard owning its instrument; no
+     * further heap allocation happens downstream.
+     *
      * @param trade Trade data to process
      * @return true if trade was queued successfully
      */
@@ -75,6 +372,19 @@ public:
      */
     size_t process_trades_batch(const std::vector<TradeData>& trades);
 
+    /**
+     * @brief Submit already-decoded POD records in batch
+     *
+     * Zero-copy ingest path for the binary wire format: each record is
+     * memcpy'd into a pooled slot and routed to its shard without any
+     * string construction or re-validation.
+     *
+     * @param records Decoded records (e.g. from BinaryTradeCodec)
+     * @param count Number of records
+     * @return Number of records successfully queued
+     */
+    size_t process_records_batch(const TradeRecord* records, size_t count);
+
     /**
      * @brief Register a custom pattern detector
      * @param pattern_name Name of the pattern
@@ -107,197 +417,294 @@ public:
      * @param pattern_name Name of the pattern to update
      * @param config New configuration parameters
      */
-    void update_pattern_config(const std::string& pattern_name, 
+    void update_pattern_config(const std::string& pattern_name,
                              const PatternConfig& config);
 
+    /**
+     * @brief Select the detector execution mode (before start())
+     * @param mode Inline execution or heavyweight offload
+     */
+    void set_execution_mode(DetectorExecutionMode mode);
+
+    /**
+     * @brief Select the detector configuration profile (after initialize())
+     *
+     * Named profiles run the built-ins through pre-instantiated constexpr
+     * threshold policies - comparisons against folded constants instead
+     * of config loads. kRuntime keeps the JSON-configured path and is the
+     * fallback for threshold sets that don't match a shipped profile.
+     *
+     * @param profile Profile to run the built-in pipeline under
+     */
+    void set_config_profile(ConfigProfile profile);
+
+    /**
+     * @brief Arm warm-restart snapshots (before initialize())
+     *
+     * initialize() will fast-load an existing snapshot at the path, and
+     * start() spawns a thread that re-snapshots the context shards at the
+     * given interval. Workers serialize their own shards at batch
+     * boundaries, so the snapshot never races the single-writer contexts.
+     * Catch-up for trades after the snapshot is the capture --replay path.
+     *
+     * @param path Snapshot file path
+     * @param interval Time between snapshots
+     */
+    void configure_snapshots(const std::string& path, std::chrono::seconds interval);
+
+    /**
+     * @brief Cut a context snapshot immediately
+     *
+     * On-demand variant of the periodic snapshot, for shard handoff on a
+     * cluster rebalance: the node giving up partitions writes its window
+     * state so the new owner warm-starts instead of going blind for a
+     * lookback window. Requires configure_snapshots() and running workers.
+     *
+     * @return true if the snapshot was written
+     */
+    bool snapshot_now();
+
+    /**
+     * @brief Enable NUMA-aware placement (before start())
+     *
+     * Workers are split into contiguous groups, one per node, and pinned
+     * to that node's CPUs; the record pool is re-provisioned one arena per
+     * node so shard routing keeps trades, contexts and pool slabs on the
+     * socket that owns them. An empty topology leaves placement disabled.
+     *
+     * @param node_cpus CPU IDs per NUMA node, index = node
+     */
+    void set_numa_topology(const std::vector<std::vector<int>>& node_cpus);
+
+    /**
+     * @brief Select the consumer wait profile (before start())
+     *
+     * Controls how workers and the alert dispatcher behave when their
+     * queues are empty: bounded spin, then yield, then park with
+     * wake-on-enqueue. See WaitProfile for the trade-offs.
+     *
+     * @param profile Deployment profile
+     */
+    void set_wait_profile(WaitProfile profile);
+
+    /**
+     * @brief Low-lane load-shedding threshold (before start())
+     *
+     * When the low-severity lane holds more than this many alerts, new
+     * low alerts are collapsed per type into periodic summary alerts
+     * instead of being queued individually.
+     *
+     * @param threshold Lane depth that triggers shedding
+     */
+    void set_alert_shed_threshold(size_t threshold);
+
+    /**
+     * @brief Register a post-detection trade sink (before start())
+     *
+     * Called from the worker thread after detection for every processed
+     * trade, with the worker's shard index. The sink runs on the hot path
+     * and must never block - intended for single-writer-per-shard
+     * consumers like the columnar archiver.
+     *
+     * @param sink Function receiving each processed trade and its shard
+     */
+    void set_trade_sink(std::function<void(const TradeRecord&, size_t)> sink);
+
+    /**
+     * @brief Attach the top-of-book quote table (before start())
+     *
+     * The context-build step seqlock-reads the trade's instrument slot
+     * and populates the HistoricalContext bid/ask fields, so the
+     * layering and front-running detectors see live quote context
+     * instead of zeros. The table is owned by the quote ingestion path.
+     *
+     * @param table Quote table, or nullptr to detach
+     */
+    void set_quote_table(const QuoteTable* table);
+
+    /**
+     * @brief Arm duplicate-trade suppression (before start())
+     *
+     * Kafka redelivers on rebalance; the deduper drops records whose
+     * trade_id hash was recently seen, before they cost a detection pass
+     * or a duplicate alert. Memory is 8 bytes per slot, fixed.
+     *
+     * @param capacity Fingerprint slots (rounded to a power of two);
+     *        0 disables dedupe
+     */
+    void configure_dedupe(size_t capacity);
+
+    /**
+     * @brief Enable sampled hot-path tracing (after initialize())
+     *
+     * Workers bracket pipeline stages (dequeue, context update, each
+     * detector, alert enqueue) with TSC reads on one trade in every
+     * sample_rate and record into per-thread rings; aggregation happens
+     * off-path on the metrics cadence. At the default 1/64 rate the
+     * measured overhead is well under 1%. A rate of 0 disables tracing.
+     *
+     * @param sample_rate Trades per sample, rounded up to a power of two
+     */
+    void configure_tracing(size_t sample_rate);
+
+    /**
+     * @brief Set a per-trade time budget for a pattern
+     *
+     * Sampled detector timings above the budget count as violations;
+     * enforce_pattern_budgets() turns sustained violations into warnings
+     * or throttling. Requires configure_tracing() first.
+     *
+     * @param pattern_name Pattern name, or "*" for every built-in
+     * @param budget Per-trade budget; zero disables
+     */
+    void set_pattern_budget(const std::string& pattern_name,
+                            std::chrono::nanoseconds budget);
+
+    /**
+     * @brief Budget enforcement policy
+     * @param max_violations Violations per window before a pattern is flagged
+     * @param window Violation counting window
+     * @param auto_throttle Disable a flagged pattern via toggle_pattern()
+     */
+    void set_budget_policy(uint32_t max_violations, std::chrono::seconds window,
+                           bool auto_throttle);
+
+    /**
+     * @brief Drain trace rings and act on budget violations
+     *
+     * Called periodically off-path (the metrics thread). Flags patterns
+     * that exceeded their budget more than the policy allows within the
+     * window, disabling them when auto-throttle is on.
+     */
+    void enforce_pattern_budgets();
+
+    /**
+     * @brief Aggregated stage and detector timings from the tracer
+     * @return Report with nanosecond timings; empty when tracing is off
+     */
+    HotPathTracer::Report get_trace_report() const;
+
 private:
     // Core processing components
     std::unique_ptr<class TradeProcessorImpl> impl_;
-    
+
     // Thread management
     std::vector<std::thread> worker_threads_;
     std::atomic<bool> running_;
     std::atomic<bool> shutdown_requested_;
-    
-    // Lock-free trade queue for high-throughput processing
-    boost::lockfree::queue<TradeData*> trade_queue_;
-    
+
+    // Per-worker lock-free queues: trades are routed by interned instrument
+    // ID so each instrument's historical context is only ever touched by a
+    // single worker thread, eliminating context cache write contention
+    std::vector<std::unique_ptr<boost::lockfree::queue<TradeRecord*>>> worker_queues_;
+
     // Pattern detectors registry
     tbb::concurrent_unordered_map<std::string, std::shared_ptr<IPatternDetector>> detectors_;
-    
-    // Configuration and statistics
+
+    // Configuration
     std::unique_ptr<PatternConfigManager> config_manager_;
-    mutable std::mutex stats_mutex_;
-    ProcessingStats statistics_;
-    
-    // Alert handling
+
+    // Alert handling: two severity-class lanes so a CRITICAL alert never
+    // queues behind a flood of low-severity noise. Depth counters are
+    // exact (push/pop maintained) because load-shedding keys off them.
+    struct AlertLanes {
+        tbb::concurrent_queue<SurveillanceAlert> high;
+        tbb::concurrent_queue<SurveillanceAlert> low;
+        std::atomic<uint64_t> high_depth{0};
+        std::atomic<uint64_t> low_depth{0};
+        std::atomic<uint64_t> collapsed{0};
+    };
+
     std::function<void(const SurveillanceAlert&)> alert_callback_;
-    tbb::concurrent_queue<SurveillanceAlert> alert_queue_;
+    std::function<void(const TradeRecord&, size_t)> trade_sink_;
+    AlertLanes alert_lanes_;
+    size_t low_lane_shed_threshold_ = 10000;
+
+    // Per-type counts of low alerts dropped while shedding; the dispatcher
+    // periodically emits one summary alert per type and zeroes the count
+    tbb::concurrent_unordered_map<std::string, std::atomic<uint64_t>> shed_low_alerts_;
+
     std::thread alert_dispatcher_thread_;
-    
-    // Performance monitoring
+
+    // Ingress-stamp to alert-dispatch latency, recorded by the dispatcher
+    // as it hands each alert to the callback
+    LatencyHistogram alert_dispatch_histogram_;
+
+    // Performance monitoring: one cache-line-padded shard per worker, each
+    // written only by its owning thread and aggregated lock-free on read
+    struct alignas(64) WorkerStatShard {
+        std::atomic<uint64_t> trades_processed{0};
+        std::atomic<uint64_t> alerts_generated{0};
+        std::atomic<uint64_t> processing_time_ns{0};
+        std::atomic<uint64_t> peak_processing_time_ns{0};
+        LatencyHistogram latency_histogram;
+
+        // Ingress-stamp to worker-dequeue residency: queue wait plus the
+        // handoff path in front of it
+        LatencyHistogram ingress_residency_histogram;
+    };
+
     std::chrono::high_resolution_clock::time_point last_stats_update_;
-    std::atomic<uint64_t> trades_processed_;
-    std::atomic<uint64_t> alerts_generated_;
-    std::atomic<uint64_t> processing_time_ns_;
-    
-    // Memory management for zero-copy processing
-    std::unique_ptr<class MemoryPool> memory_pool_;
-    
-    // Worker thread function
-    void worker_thread_func();
-    
+    std::vector<std::unique_ptr<WorkerStatShard>> stat_shards_;
+
+    // Worker thread function; each worker drains its own queue and owns
+    // the context shard with the same index
+    void worker_thread_func(size_t worker_index);
+
     // Alert dispatcher thread function
     void alert_dispatcher_func();
-    
-    // Process single trade (internal)
-    void process_trade_internal(const TradeData& trade);
-    
+
+    // Route an alert to its severity lane, shedding the low lane past the
+    // configured depth
+    void enqueue_alert(SurveillanceAlert&& alert);
+
+    // Emit one summary alert per type shed since the last flush
+    void flush_shed_low_alerts();
+
+    // Process single trade on its owning shard (internal); sampled trades
+    // record per-stage trace timings
+    void process_trade_internal(const TradeRecord& trade, size_t shard_index,
+                                bool sampled = false);
+
+    // Submit a worker's pending heavyweight-detector batch to the offload
+    // pool (kOffloadHeavy mode only)
+    void flush_heavy_batch(size_t worker_index);
+
+    // Warm-restart snapshots: coordinator thread, one collection pass
+    // across the shards, and the initialize()-time fast load
+    void snapshot_thread_func();
+    bool save_context_snapshot();
+    bool load_context_snapshot();
+
+    std::string snapshot_path_;
+    std::chrono::seconds snapshot_interval_{0};
+    std::thread snapshot_thread_;
+
+    // Per-pattern budget enforcement state, touched only by
+    // enforce_pattern_budgets() on the metrics cadence
+    struct BudgetWindow {
+        uint64_t violations = 0;
+        std::chrono::steady_clock::time_point window_start{};
+        bool throttled = false;
+    };
+
+    std::unordered_map<std::string, BudgetWindow> budget_windows_;
+    uint32_t budget_max_violations_ = 1000;
+    std::chrono::seconds budget_window_{60};
+    bool budget_auto_throttle_ = false;
+
     // Update processing statistics
     void update_statistics();
-    
+
     // Initialize built-in pattern detectors
     void initialize_builtin_detectors();
-    
+
     // Load configuration from file
     bool load_configuration(const std::string& config_path);
-    
+
     // Validate trade data
     bool validate_trade_data(const TradeData& trade) const;
 };
 
-/**
- * @brief Interface for pattern detector implementations
- */
-class IPatternDetector {
-public:
-    virtual ~IPatternDetector() = default;
-    
-    /**
-     * @brief Detect pattern in trade data
-     * @param trade Current trade to analyze
-     * @param historical_context Historical data for context
-     * @return Optional alert if pattern detected
-     */
-    virtual std::optional<SurveillanceAlert> detect_pattern(
-        const TradeData& trade,
-        const HistoricalContext& historical_context) = 0;
-    
-    /**
-     * @brief Update detector configuration
-     * @param config New configuration parameters
-     */
-    virtual void update_config(const PatternConfig& config) = 0;
-    
-    /**
-     * @brief Get detector name
-     * @return String identifier for the detector
-     */
-    virtual std::string get_name() const = 0;
-    
-    /**
-     * @brief Check if detector is enabled
-     * @return true if detector is active
-     */
-    virtual bool is_enabled() const = 0;
-    
-    /**
-     * @brief Enable or disable the detector
-     * @param enabled New enabled state
-     */
-    virtual void set_enabled(bool enabled) = 0;
-};
-
-/**
- * @brief Processing statistics structure
- */
-struct ProcessingStats {
-    uint64_t total_trades_processed = 0;
-    uint64_t total_alerts_generated = 0;
-    uint64_t queue_size = 0;
-    uint64_t avg_processing_time_ns = 0;
-    uint64_t peak_processing_time_ns = 0;
-    double throughput_trades_per_second = 0.0;
-    double cpu_utilization_percent = 0.0;
-    uint64_t memory_usage_bytes = 0;
-    std::chrono::system_clock::time_point last_updated;
-    
-    // Per-pattern statistics
-    std::unordered_map<std::string, uint64_t> pattern_alerts_count;
-    std::unordered_map<std::string, uint64_t> pattern_processing_time_ns;
-};
-
-/**
- * @brief Trade data structure optimized for high-frequency processing
- */
-struct TradeData {
-    // Core trade information
-    std::string trade_id;
-    std::string instrument_symbol;
-    std::string account_id;
-    std::string client_id;
-    
-    // Trade details
-    enum class TradeType { BUY, SELL, SHORT_SELL, COVER } trade_type;
-    enum class MarketSegment { EQUITY, FUTURES, OPTIONS, COMMODITY, CURRENCY } segment;
-    
-    uint64_t quantity;
-    double price;
-    double value;
-    std::string exchange;
-    std::chrono::system_clock::time_point timestamp;
-    
-    // Extended information for surveillance
-    std::string order_id;
-    std::string trader_id;
-    bool is_own_account;
-    double brokerage;
-    double taxes;
-    
-    // Performance optimization: avoid string allocations
-    uint32_t instrument_id_hash;
-    uint32_t account_id_hash;
-    uint32_t client_id_hash;
-    
-    // Validation
-    bool is_valid() const {
-        return !trade_id.empty() && 
-               !instrument_symbol.empty() && 
-               quantity > 0 && 
-               price > 0.0 && 
-               value > 0.0;
-    }
-};
-
-/**
- * @brief Historical context for pattern detection
- */
-struct HistoricalContext {
-    // Time window configuration
-    std::chrono::minutes lookback_window{5};
-    
-    // Recent trades for the same instrument
-    std::vector<TradeData> recent_trades;
-    
-    // Volume and price statistics
-    double avg_volume = 0.0;
-    double avg_price = 0.0;
-    double price_volatility = 0.0;
-    
-    // Market data
-    double bid_price = 0.0;
-    double ask_price = 0.0;
-    uint64_t bid_quantity = 0;
-    uint64_t ask_quantity = 0;
-    
-    // Account-specific history
-    std::vector<TradeData> account_recent_trades;
-    double account_total_volume = 0.0;
-    
-    // Cross-references
-    std::vector<std::string> related_accounts;
-    std::vector<std::string> related_instruments;
-};
-
 } // namespace surveillance
 } // namespace dharmaguard
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace dharmaguard {
+namespace surveillance {
+
+/**
+ * @brief Deployment profiles for consumer wait behavior
+ *
+ * kLatencyCritical trades idle CPU for the fastest possible wakeup;
+ * kPowerSaving parks almost immediately for 24x7 quiet periods on shared
+ * hosts; kBalanced sits between and is the default.
+ */
+enum class WaitProfile {
+    kLatencyCritical,
+    kBalanced,
+    kPowerSaving
+};
+
+/**
+ * @brief Progressive spin / yield / park wait for queue consumers
+ *
+ * Replaces the raw yield-spin in the worker loops and the fixed 1ms
+ * dispatcher sleep. A consumer calls idle() each time it finds nothing to
+ * do: the strategy first busy-spins with a CPU pause, then yields, then
+ * parks on a condition variable. Producers call notify() after an
+ * enqueue; the fast path is a single relaxed load when nobody is parked,
+ * so the hot enqueue path pays one branch.
+ *
+ * Parking uses a bounded timed wait, so a wakeup lost to the unavoidable
+ * check-then-park race costs at most one park interval, never a hang.
+ * One strategy instance per consumer thread; notify() is safe from any
+ * number of producers.
+ */
+class WaitStrategy {
+public:
+    explicit WaitStrategy(WaitProfile profile = WaitProfile::kBalanced) {
+        switch (profile) {
+            case WaitProfile::kLatencyCritical:
+                spin_limit_ = 4096;
+                yield_limit_ = spin_limit_ + 512;
+                park_interval_ = std::chrono::microseconds(100);
+                break;
+            case WaitProfile::kBalanced:
+                spin_limit_ = 256;
+                yield_limit_ = spin_limit_ + 64;
+                park_interval_ = std::chrono::microseconds(1000);
+                break;
+            case WaitProfile::kPowerSaving:
+                spin_limit_ = 0;
+                yield_limit_ = 8;
+                park_interval_ = std::chrono::microseconds(10000);
+                break;
+        }
+    }
+
+    /**
+     * @brief Wait a little; escalates on consecutive calls
+     *
+     * Call when a poll found no work. Resets automatically via reset()
+     * when work is found.
+     */
+    void idle() {
+        uint32_t count = idle_count_++;
+        if (count < spin_limit_) {
+            cpu_pause();
+        } else if (count < yield_limit_) {
+            std::this_thread::yield();
+        } else {
+            park();
+        }
+    }
+
+    /** @brief Record that work was found; restart the escalation ladder */
+    void reset() {
+        idle_count_ = 0;
+    }
+
+    /**
+     * @brief Wake the consumer if it is parked (producer side)
+     */
+    void notify() {
+        if (parked_.load(std::memory_order_acquire)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                signaled_ = true;
+            }
+            cv_.notify_one();
+        }
+    }
+
+private:
+    static void cpu_pause() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    void park() {
+        parked_.store(true, std::memory_order_release);
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait_for(lock, park_interval_, [this] { return signaled_; });
+            signaled_ = false;
+        }
+        parked_.store(false, std::memory_order_release);
+    }
+
+    uint32_t spin_limit_;
+    uint32_t yield_limit_;
+    std::chrono::microseconds park_interval_;
+
+    uint32_t idle_count_ = 0;
+
+    std::atomic<bool> parked_{false};
+    bool signaled_ = false;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,191 @@
+#include "capture/trade_capture.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <spdlog/spdlog.h>
+
+#include <cstring>
+
+namespace dharmaguard {
+namespace capture {
+
+// ---------------------------------------------------------------------------
+// TradeCaptureWriter
+// ---------------------------------------------------------------------------
+
+TradeCaptureWriter::~TradeCaptureWriter() {
+    close();
+}
+
+bool TradeCaptureWriter::open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (file_) {
+        spdlog::warn("Capture writer already open, ignoring open({})", path);
+        return false;
+    }
+
+    // Append to an existing capture or start a fresh one with a header
+    bool exists = ::access(path.c_str(), F_OK) == 0;
+    file_ = std::fopen(path.c_str(), exists ? "ab" : "wb");
+    if (!file_) {
+        spdlog::error("Failed to open capture file: {}", path);
+        return false;
+    }
+
+    if (!exists) {
+        CaptureFileHeader header{};
+        header.magic = CaptureFileHeader::kMagic;
+        header.version = CaptureFileHeader::kVersion;
+        header.flags = 0;
+        header.record_size = sizeof(messaging::WireTradeRecord);
+        header.reserved = 0;
+
+        if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+            spdlog::error("Failed to write capture header: {}", path);
+            std::fclose(file_);
+            file_ = nullptr;
+            return false;
+        }
+    }
+
+    buffer_.reserve(kFlushBatch);
+    spdlog::info("Trade capture {} {}", exists ? "appending to" : "opened", path);
+    return true;
+}
+
+void TradeCaptureWriter::append(const surveillance::TradeRecord& record) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!file_) {
+        return;
+    }
+
+    buffer_.emplace_back();
+    messaging::BinaryTradeCodec::encode_record(record, buffer_.back());
+
+    if (buffer_.size() >= kFlushBatch) {
+        flush_locked();
+    }
+}
+
+void TradeCaptureWriter::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_) {
+        flush_locked();
+        std::fflush(file_);
+    }
+}
+
+void TradeCaptureWriter::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!file_) {
+        return;
+    }
+
+    flush_locked();
+    std::fflush(file_);
+    std::fclose(file_);
+    file_ = nullptr;
+
+    spdlog::info("Trade capture closed after {} records", records_written_);
+}
+
+void TradeCaptureWriter::flush_locked() {
+    if (buffer_.empty()) {
+        return;
+    }
+
+    size_t written = std::fwrite(buffer_.data(), sizeof(messaging::WireTradeRecord),
+                                 buffer_.size(), file_);
+    if (written != buffer_.size()) {
+        spdlog::error("Short write to capture file: {} of {} records",
+                      written, buffer_.size());
+    }
+
+    records_written_ += written;
+    buffer_.clear();
+}
+
+// ---------------------------------------------------------------------------
+// TradeCaptureReader
+// ---------------------------------------------------------------------------
+
+TradeCaptureReader::~TradeCaptureReader() {
+    close();
+}
+
+bool TradeCaptureReader::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        spdlog::error("Failed to open capture file: {}", path);
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(CaptureFileHeader)) {
+        spdlog::error("Capture file too small or unreadable: {}", path);
+        ::close(fd);
+        return false;
+    }
+
+    mapping_size_ = static_cast<size_t>(st.st_size);
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapping_ == MAP_FAILED) {
+        spdlog::error("Failed to mmap capture file: {}", path);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+        return false;
+    }
+
+    // Replay reads the mapping front to back; tell the kernel so
+    ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+
+    CaptureFileHeader header;
+    std::memcpy(&header, mapping_, sizeof(header));
+
+    if (header.magic != CaptureFileHeader::kMagic) {
+        spdlog::error("Capture file has bad magic: {:#x}", header.magic);
+        close();
+        return false;
+    }
+    if (header.version != CaptureFileHeader::kVersion) {
+        spdlog::error("Unsupported capture file version: {}", header.version);
+        close();
+        return false;
+    }
+    if (header.record_size != sizeof(messaging::WireTradeRecord)) {
+        spdlog::error("Capture record size mismatch: file has {}, expected {}",
+                      header.record_size, sizeof(messaging::WireTradeRecord));
+        close();
+        return false;
+    }
+
+    // Ignore a trailing partial record from a torn final write
+    records_ = reinterpret_cast<const messaging::WireTradeRecord*>(
+        static_cast<const uint8_t*>(mapping_) + sizeof(CaptureFileHeader));
+    record_count_ = (mapping_size_ - sizeof(CaptureFileHeader)) /
+                    sizeof(messaging::WireTradeRecord);
+
+    spdlog::info("Mapped capture file {} - {} records", path, record_count_);
+    return true;
+}
+
+void TradeCaptureReader::close() {
+    if (mapping_) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+    }
+    mapping_size_ = 0;
+    records_ = nullptr;
+    record_count_ = 0;
+}
+
+} // namespace capture
+} // namespace dharmaguard
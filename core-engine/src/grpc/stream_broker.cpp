@@ -0,0 +1,94 @@
+#include "grpc/stream_broker.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace dharmaguard {
+namespace grpc {
+
+bool AlertStreamBroker::Subscription::next_batch(
+    std::vector<surveillance::SurveillanceAlert>& batch,
+    std::chrono::milliseconds timeout) {
+
+    batch.clear();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_for(lock, timeout, [this] {
+        return queue_.size() >= options_.batch_size || cancelled_.load();
+    });
+
+    size_t take = std::min(queue_.size(), options_.batch_size);
+    for (size_t i = 0; i < take; ++i) {
+        batch.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+    }
+
+    return !batch.empty() || !cancelled_.load();
+}
+
+void AlertStreamBroker::Subscription::cancel() {
+    cancelled_.store(true);
+    cv_.notify_all();
+}
+
+void AlertStreamBroker::Subscription::offer(const surveillance::SurveillanceAlert& alert) {
+    if (cancelled_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (alert.severity < options_.min_severity) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Per-subscriber backpressure: a slow consumer sheds its own
+        // oldest alerts instead of stalling the publisher
+        if (queue_.size() >= options_.max_queue_depth) {
+            queue_.pop_front();
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+        queue_.push_back(alert);
+    }
+    cv_.notify_one();
+}
+
+std::shared_ptr<AlertStreamBroker::Subscription>
+AlertStreamBroker::subscribe(SubscriptionOptions options) {
+    auto subscription = std::shared_ptr<Subscription>(new Subscription(options));
+
+    std::lock_guard<std::mutex> lock(subscribers_mutex_);
+    subscribers_.push_back(subscription);
+
+    spdlog::info("Alert stream subscriber added (batch: {}, queue depth: {}), total: {}",
+                 options.batch_size, options.max_queue_depth, subscribers_.size());
+    return subscription;
+}
+
+void AlertStreamBroker::unsubscribe(const std::shared_ptr<Subscription>& subscription) {
+    subscription->cancel();
+
+    std::lock_guard<std::mutex> lock(subscribers_mutex_);
+    subscribers_.erase(
+        std::remove(subscribers_.begin(), subscribers_.end(), subscription),
+        subscribers_.end());
+
+    spdlog::info("Alert stream subscriber removed (dropped {} alerts), total: {}",
+                 subscription->dropped_count(), subscribers_.size());
+}
+
+void AlertStreamBroker::publish(const surveillance::SurveillanceAlert& alert) {
+    std::lock_guard<std::mutex> lock(subscribers_mutex_);
+    for (const auto& subscription : subscribers_) {
+        subscription->offer(alert);
+    }
+}
+
+size_t AlertStreamBroker::subscriber_count() const {
+    std::lock_guard<std::mutex> lock(subscribers_mutex_);
+    return subscribers_.size();
+}
+
+} // namespace grpc
+} // namespace dharmaguard
@@ -1,8 +1,10 @@
+#include <array>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <csignal>
 #include <atomic>
+#include <sstream>
 #include <thread>
 #include <chrono>
 
@@ -11,11 +13,19 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/rotating_file_sink.h>
 
+#include "capture/trade_capture.hpp"
+#include "surveillance/backtest_runner.hpp"
 #include "surveillance/trade_pattern_detector.hpp"
 #include "grpc/surveillance_service.hpp"
 #include "database/postgres_connection.hpp"
 #include "database/redis_connection.hpp"
+#include "database/clickhouse_connection.hpp"
+#include "database/connection_pool.hpp"
+#include "persistence/alert_writer.hpp"
+#include "persistence/trade_archiver.hpp"
 #include "messaging/kafka_consumer.hpp"
+#include "messaging/binary_trade_codec.hpp"
+#include "messaging/cluster_coordinator.hpp"
 #include "utils/config_manager.hpp"
 #include "utils/logger.hpp"
 #include "utils/metrics_collector.hpp"
@@ -26,6 +36,37 @@ namespace po = boost::program_options;
 // Global flag for graceful shutdown
 std::atomic<bool> shutdown_requested{false};
 
+// Parse a NUMA topology string like "0-15,32-47;16-31,48-63" - nodes
+// separated by ';', each a comma list of CPU IDs or dash ranges
+std::vector<std::vector<int>> parse_numa_topology(const std::string& spec) {
+    std::vector<std::vector<int>> nodes;
+
+    std::stringstream node_stream(spec);
+    std::string node_spec;
+    while (std::getline(node_stream, node_spec, ';')) {
+        std::vector<int> cpus;
+        std::stringstream cpu_stream(node_spec);
+        std::string token;
+        while (std::getline(cpu_stream, token, ',')) {
+            auto dash = token.find('-');
+            if (dash == std::string::npos) {
+                cpus.push_back(std::stoi(token));
+            } else {
+                int first = std::stoi(token.substr(0, dash));
+                int last = std::stoi(token.substr(dash + 1));
+                for (int cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        if (!cpus.empty()) {
+            nodes.push_back(std::move(cpus));
+        }
+    }
+
+    return nodes;
+}
+
 // Signal handler for graceful shutdown
 void signal_handler(int signal) {
     spdlog::info("Received signal {}, initiating graceful shutdown...", signal);
@@ -37,6 +78,14 @@ public:
     DharmaGuardEngine() = default;
     ~DharmaGuardEngine() = default;
 
+    /**
+     * @brief Run from a capture file instead of live Kafka
+     *
+     * Must be called before initialize(); the Kafka consumer and capture
+     * tee are skipped so the replay is the only trade source.
+     */
+    void set_replay_mode(bool enabled) { replay_mode_ = enabled; }
+
     bool initialize(const std::string& config_file) {
         try {
             // Initialize configuration manager
@@ -61,23 +110,134 @@ public:
             
             pattern_detector_ = std::make_unique<surveillance::TradePatternDetector>(
                 num_threads, queue_size);
-            
+
+            // Warm-restart snapshots: initialize() below fast-loads the
+            // last snapshot so detectors start with full windows
+            auto snapshot_path = config_manager_->get<std::string>(
+                "surveillance.snapshot_path", "");
+            if (!snapshot_path.empty()) {
+                pattern_detector_->configure_snapshots(
+                    snapshot_path,
+                    std::chrono::seconds(config_manager_->get<int>(
+                        "surveillance.snapshot_interval_seconds", 60)));
+            }
+
             if (!pattern_detector_->initialize(config_file)) {
                 spdlog::error("Failed to initialize trade pattern detector");
                 return false;
             }
 
+            // NUMA placement: pin worker groups and provision per-node
+            // pools when a topology is configured for this host class
+            if (config_manager_->get<bool>("surveillance.numa.enabled", false)) {
+                auto topology = parse_numa_topology(config_manager_->get<std::string>(
+                    "surveillance.numa.topology", ""));
+                if (topology.empty()) {
+                    spdlog::warn("surveillance.numa.enabled set but topology is "
+                                 "empty/unparsable, placement disabled");
+                } else {
+                    pattern_detector_->set_numa_topology(topology);
+                }
+            }
+
+            // Detectors run inline on workers by default; "offload_heavy"
+            // batches the heavyweight detectors onto a dedicated pool
+            auto execution_mode = config_manager_->get<std::string>(
+                "surveillance.execution_mode", "inline");
+            pattern_detector_->set_execution_mode(
+                execution_mode == "offload_heavy"
+                    ? surveillance::DetectorExecutionMode::kOffloadHeavy
+                    : surveillance::DetectorExecutionMode::kInline);
+
+            // Threshold profile: named profiles run the built-ins through
+            // constexpr policies with the thresholds folded in; anything
+            // unrecognized stays on the JSON-configured runtime path
+            auto profile_name = config_manager_->get<std::string>(
+                "surveillance.detector_profile", "runtime");
+            if (auto profile = surveillance::config_profile_from_string(profile_name)) {
+                pattern_detector_->set_config_profile(*profile);
+            } else {
+                spdlog::warn("Unknown detector profile '{}', using runtime config",
+                             profile_name);
+            }
+
+            // Idle wait behavior per deployment profile: latency-critical
+            // hosts spin longer, shared/overnight hosts park quickly
+            auto wait_profile = config_manager_->get<std::string>(
+                "surveillance.wait_profile", "balanced");
+            pattern_detector_->set_wait_profile(
+                wait_profile == "latency_critical"
+                    ? surveillance::WaitProfile::kLatencyCritical
+                : wait_profile == "power_saving"
+                    ? surveillance::WaitProfile::kPowerSaving
+                    : surveillance::WaitProfile::kBalanced);
+
+            pattern_detector_->set_alert_shed_threshold(
+                config_manager_->get<size_t>("surveillance.alert_shed_threshold", 10000));
+
+            // Duplicate suppression for Kafka redeliveries on rebalance
+            pattern_detector_->configure_dedupe(
+                config_manager_->get<size_t>("surveillance.dedupe_capacity", 1 << 20));
+
+            // Sampled hot-path tracing; stage/detector timings aggregate
+            // off-path on the metrics cadence, budgets catch a detector
+            // that starts sinking whole-engine latency
+            if (config_manager_->get<bool>("surveillance.tracing.enabled", true)) {
+                pattern_detector_->configure_tracing(
+                    config_manager_->get<size_t>("surveillance.tracing.sample_rate", 64));
+
+                auto budget_us = config_manager_->get<int>(
+                    "surveillance.tracing.pattern_budget_us", 0);
+                if (budget_us > 0) {
+                    pattern_detector_->set_pattern_budget(
+                        "*", std::chrono::microseconds(budget_us));
+                    pattern_detector_->set_budget_policy(
+                        config_manager_->get<uint32_t>(
+                            "surveillance.tracing.budget_violations", 1000),
+                        std::chrono::seconds(config_manager_->get<int>(
+                            "surveillance.tracing.budget_window_seconds", 60)),
+                        config_manager_->get<bool>(
+                            "surveillance.tracing.auto_throttle", false));
+                }
+            }
+
             // Set up alert callback
             pattern_detector_->set_alert_callback(
                 [this](const surveillance::SurveillanceAlert& alert) {
                     handle_surveillance_alert(alert);
                 });
 
-            // Initialize Kafka consumer for real-time trade data
-            if (!initialize_kafka_consumer()) {
+            // Columnar archival to ClickHouse, fed per shard after
+            // detection so the hot path only appends to a column buffer
+            if (!initialize_trade_archiver(num_threads)) {
+                return false;
+            }
+
+            // Clustered mode: instrument-range sharding aligned with the
+            // Kafka partition assignment, shard map distributed via Redis
+            if (!initialize_cluster()) {
                 return false;
             }
 
+            // Live ingest only: replay feeds the detector directly from
+            // the capture mapping
+            if (!replay_mode_) {
+                if (!initialize_capture_writer()) {
+                    return false;
+                }
+
+                // Top-of-book quote stream feeding the in-process quote
+                // table the context-build step reads per trade
+                if (!initialize_quote_consumer()) {
+                    return false;
+                }
+
+                // Initialize Kafka consumer for real-time trade data
+                if (!initialize_kafka_consumer()) {
+                    return false;
+                }
+            }
+
             // Initialize gRPC service
             if (!initialize_grpc_service()) {
                 return false;
@@ -98,14 +258,31 @@ public:
 
     bool start() {
         try {
+            // Start the alert persistence stage before anything can emit
+            if (!alert_writer_->start()) {
+                spdlog::error("Failed to start alert writer");
+                return false;
+            }
+
+            if (trade_archiver_ && !trade_archiver_->start()) {
+                spdlog::error("Failed to start trade archiver");
+                return false;
+            }
+
             // Start pattern detector
             if (!pattern_detector_->start()) {
                 spdlog::error("Failed to start trade pattern detector");
                 return false;
             }
 
-            // Start Kafka consumer
-            if (!kafka_consumer_->start()) {
+            // Quotes first so contexts enrich from the first trade on
+            if (quote_consumer_ && !quote_consumer_->start()) {
+                spdlog::error("Failed to start quote consumer");
+                return false;
+            }
+
+            // Start Kafka consumer (absent in replay mode)
+            if (kafka_consumer_ && !kafka_consumer_->start()) {
                 spdlog::error("Failed to start Kafka consumer");
                 return false;
             }
@@ -154,6 +331,91 @@ public:
         stop();
     }
 
+    /**
+     * @brief Stream a capture file through the detection pipeline
+     *
+     * Decodes the memory-mapped record run in fixed-size batches into the
+     * POD ingest path. With original_timing the inter-trade gaps from the
+     * captured timestamps are reproduced; otherwise records are pushed as
+     * fast as the workers drain them.
+     */
+    bool replay(const std::string& capture_file, bool original_timing) {
+        capture::TradeCaptureReader reader;
+        if (!reader.open(capture_file)) {
+            return false;
+        }
+
+        constexpr size_t kReplayBatch = 1024;
+        std::vector<surveillance::TradeRecord> batch;
+        batch.reserve(kReplayBatch);
+
+        auto replay_start = std::chrono::steady_clock::now();
+        int64_t first_timestamp_ns =
+            reader.size() > 0 ? reader.record(0).timestamp_ns : 0;
+
+        size_t submitted = 0;
+        for (size_t i = 0; i < reader.size() && !shutdown_requested.load();) {
+            batch.clear();
+            while (i < reader.size() && batch.size() < kReplayBatch) {
+                const auto& wire = reader.record(i);
+
+                if (original_timing) {
+                    auto capture_offset = std::chrono::nanoseconds(
+                        wire.timestamp_ns - first_timestamp_ns);
+                    auto due = replay_start + capture_offset;
+                    if (std::chrono::steady_clock::now() < due) {
+                        break;
+                    }
+                }
+
+                batch.emplace_back();
+                messaging::BinaryTradeCodec::decode_record(wire, batch.back());
+                ++i;
+            }
+
+            if (batch.empty()) {
+                // Ahead of the tape; wait for the next record to come due
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                continue;
+            }
+
+            // Stamp the replay ingress boundary so the residency
+            // histograms measure this run, not the capture's clock
+            const int64_t ingress_ns = surveillance::ingress_now_ns();
+            for (auto& record : batch) {
+                record.ingress_ns = ingress_ns;
+            }
+
+            size_t queued = 0;
+            while (queued < batch.size() && !shutdown_requested.load()) {
+                queued += pattern_detector_->process_records_batch(
+                    batch.data() + queued, batch.size() - queued);
+                if (queued < batch.size()) {
+                    // Shard queues full - let the workers drain
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+            submitted += queued;
+        }
+
+        // Let the workers finish the tail before reporting
+        while (pattern_detector_->get_statistics().queue_size > 0 &&
+               !shutdown_requested.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - replay_start);
+        double rate = elapsed.count() > 0
+            ? static_cast<double>(submitted) * 1000.0 / elapsed.count()
+            : 0.0;
+
+        spdlog::info("Replay complete: {} of {} records in {} ms ({:.0f} trades/sec)",
+                     submitted, reader.size(), elapsed.count(), rate);
+        print_statistics();
+        return true;
+    }
+
     void stop() {
         try {
             // Stop services in reverse order
@@ -165,10 +427,41 @@ public:
                 kafka_consumer_->stop();
             }
 
+            if (quote_consumer_) {
+                quote_consumer_->stop();
+            }
+
+            // No rebalance may fire once ingest has stopped
+            if (cluster_coordinator_) {
+                cluster_coordinator_->stop();
+            }
+
             if (pattern_detector_) {
                 pattern_detector_->stop();
             }
 
+            // Workers are quiescent now, so the archiver can seal and
+            // flush the shard buffers they owned
+            if (trade_archiver_) {
+                trade_archiver_->stop();
+            }
+
+            if (alert_writer_) {
+                alert_writer_->stop();
+            }
+
+            // Pools drain after the writer so its final flushes land
+            if (postgres_pool_) {
+                postgres_pool_->stop();
+            }
+            if (redis_pool_) {
+                redis_pool_->stop();
+            }
+
+            if (capture_writer_) {
+                capture_writer_->close();
+            }
+
             if (metrics_collector_) {
                 metrics_collector_->stop();
             }
@@ -186,12 +479,26 @@ private:
     std::unique_ptr<grpc::SurveillanceService> grpc_service_;
     std::unique_ptr<database::PostgresConnection> postgres_connection_;
     std::unique_ptr<database::RedisConnection> redis_connection_;
+    std::unique_ptr<database::ClickHouseConnection> clickhouse_connection_;
+    std::unique_ptr<database::ConnectionPool<database::PostgresConnection>> postgres_pool_;
+    std::unique_ptr<database::ConnectionPool<database::RedisConnection>> redis_pool_;
+    std::unique_ptr<persistence::AlertWriter> alert_writer_;
+    std::unique_ptr<persistence::TradeArchiver> trade_archiver_;
     std::unique_ptr<messaging::KafkaConsumer> kafka_consumer_;
+    std::unique_ptr<messaging::KafkaConsumer> quote_consumer_;
+    std::unique_ptr<surveillance::QuoteTable> quote_table_;
+    std::unique_ptr<messaging::ClusterCoordinator> cluster_coordinator_;
+    std::unique_ptr<capture::TradeCaptureWriter> capture_writer_;
     std::unique_ptr<utils::MetricsCollector> metrics_collector_;
+    bool replay_mode_{false};
 
     std::thread metrics_thread_;
     std::atomic<bool> metrics_running_{false};
 
+    // Ingress stamp to alert handler, one step past the dispatcher; the
+    // full path a production alert travels before persistence fan-out
+    surveillance::LatencyHistogram alert_handler_latency_;
+
     void setup_logging() {
         auto log_level = config_manager_->get<std::string>("logging.level", "info");
         auto log_file = config_manager_->get<std::string>("logging.file", "dharmaguard.log");
@@ -243,20 +550,261 @@ private:
             return false;
         }
 
+        // Async pools on top of the primary connections: alert flushes,
+        // metrics queries, and hourly maintenance each get their own lane
+        // instead of serializing on one socket per database
+        database::ConnectionPool<database::PostgresConnection>::Config pg_pool_config;
+        pg_pool_config.connections =
+            config_manager_->get<size_t>("database.postgres.pool_size", 4);
+        postgres_pool_ = std::make_unique<
+            database::ConnectionPool<database::PostgresConnection>>(
+            "postgres",
+            [postgres_config]() -> std::unique_ptr<database::PostgresConnection> {
+                auto connection = std::make_unique<database::PostgresConnection>();
+                if (!connection->connect(postgres_config)) {
+                    return nullptr;
+                }
+                return connection;
+            },
+            pg_pool_config);
+
+        database::ConnectionPool<database::RedisConnection>::Config redis_pool_config;
+        redis_pool_config.connections =
+            config_manager_->get<size_t>("database.redis.pool_size", 2);
+        redis_pool_ = std::make_unique<
+            database::ConnectionPool<database::RedisConnection>>(
+            "redis",
+            [redis_config]() -> std::unique_ptr<database::RedisConnection> {
+                auto connection = std::make_unique<database::RedisConnection>();
+                if (!connection->connect(redis_config)) {
+                    return nullptr;
+                }
+                return connection;
+            },
+            redis_pool_config);
+
+        if (!postgres_pool_->start() || !redis_pool_->start()) {
+            spdlog::error("Failed to start database connection pools");
+            return false;
+        }
+
+        // Write-behind persistence: alerts are batched into Postgres COPY
+        // and Redis pipeline flushes so detection never blocks on I/O
+        persistence::AlertWriter::Config writer_config;
+        writer_config.max_batch_size =
+            config_manager_->get<size_t>("persistence.alert_batch_size", 500);
+        writer_config.flush_interval = std::chrono::milliseconds(
+            config_manager_->get<int>("persistence.alert_flush_interval_ms", 100));
+        writer_config.max_queue_depth =
+            config_manager_->get<size_t>("persistence.alert_queue_depth", 100000);
+        writer_config.spill_path = config_manager_->get<std::string>(
+            "persistence.alert_spill_path", "alert_spill.journal");
+
+        alert_writer_ = std::make_unique<persistence::AlertWriter>(
+            postgres_connection_.get(), redis_connection_.get(), writer_config);
+        alert_writer_->set_connection_pools(postgres_pool_.get(), redis_pool_.get());
+
         spdlog::info("Database connections initialized successfully");
         return true;
     }
 
+    bool initialize_trade_archiver(size_t num_shards) {
+        if (!config_manager_->get<bool>("archival.enabled", false)) {
+            return true;
+        }
+
+        auto clickhouse_config = config_manager_->get_section("database.clickhouse");
+        clickhouse_connection_ = std::make_unique<database::ClickHouseConnection>();
+
+        if (!clickhouse_connection_->connect(clickhouse_config)) {
+            spdlog::error("Failed to connect to ClickHouse");
+            return false;
+        }
+
+        persistence::TradeArchiver::Config archiver_config;
+        archiver_config.block_rows =
+            config_manager_->get<size_t>("archival.block_rows", 65536);
+        archiver_config.max_pending_blocks =
+            config_manager_->get<size_t>("archival.max_pending_blocks", 64);
+        archiver_config.max_block_age = std::chrono::seconds(
+            config_manager_->get<int>("archival.max_block_age_seconds", 5));
+        archiver_config.table = config_manager_->get<std::string>(
+            "archival.table", "trades_archive");
+
+        trade_archiver_ = std::make_unique<persistence::TradeArchiver>(
+            clickhouse_connection_.get(), num_shards, archiver_config);
+
+        pattern_detector_->set_trade_sink(
+            [this](const surveillance::TradeRecord& record, size_t shard_index) {
+                trade_archiver_->append(shard_index, record);
+            });
+
+        return true;
+    }
+
+    bool initialize_capture_writer() {
+        if (!config_manager_->get<bool>("capture.enabled", false)) {
+            return true;
+        }
+
+        auto capture_path = config_manager_->get<std::string>(
+            "capture.path", "trades.dgcap");
+
+        capture_writer_ = std::make_unique<capture::TradeCaptureWriter>();
+        if (!capture_writer_->open(capture_path)) {
+            spdlog::error("Failed to open trade capture file: {}", capture_path);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool initialize_cluster() {
+        if (!config_manager_->get<bool>("cluster.enabled", false)) {
+            return true;
+        }
+
+        messaging::ClusterCoordinator::Config cluster_config;
+        cluster_config.node_id =
+            config_manager_->get<uint32_t>("cluster.node_id", 0);
+        cluster_config.total_nodes =
+            config_manager_->get<uint32_t>("cluster.total_nodes", 1);
+        cluster_config.kafka_partitions =
+            config_manager_->get<uint32_t>("cluster.kafka_partitions", 16);
+        cluster_config.refresh_interval = std::chrono::seconds(
+            config_manager_->get<int>("cluster.refresh_interval_seconds", 10));
+
+        cluster_coordinator_ = std::make_unique<messaging::ClusterCoordinator>(
+            redis_connection_.get(), cluster_config);
+
+        // Correlation scope declarations: each entry maps a group name to
+        // the co-traded instruments that must land on one node, e.g.
+        // {"nifty_arb": ["NIFTY-FUT", "NIFTY-OPT", "RELIANCE"]}
+        auto groups = config_manager_->get_section("cluster.correlation_groups");
+        for (const auto& entry : groups) {
+            std::vector<std::string> instruments;
+            for (const auto& symbol : entry.value().as_array()) {
+                instruments.emplace_back(symbol.as_string());
+            }
+            cluster_coordinator_->declare_correlation_group(
+                std::string(entry.key()), instruments);
+        }
+
+        cluster_coordinator_->set_rebalance_callback(
+            [this](const messaging::ShardMap& previous,
+                   const messaging::ShardMap& current) {
+                handle_cluster_rebalance(previous, current);
+            });
+
+        if (!cluster_coordinator_->start()) {
+            spdlog::error("Failed to start cluster coordinator");
+            return false;
+        }
+        return true;
+    }
+
+    void handle_cluster_rebalance(const messaging::ShardMap& previous,
+                                  const messaging::ShardMap& current) {
+        // Cut a snapshot first so the partitions this node gives up carry
+        // their window state to the new owner instead of it going blind
+        // for a lookback window
+        if (pattern_detector_) {
+            pattern_detector_->snapshot_now();
+        }
+
+        if (kafka_consumer_) {
+            kafka_consumer_->assign_partitions(
+                cluster_coordinator_->owned_partitions());
+        }
+
+        spdlog::info("Cluster rebalance applied: map version {} -> {}",
+                     previous.version, current.version);
+    }
+
+    bool initialize_quote_consumer() {
+        if (!config_manager_->get<bool>("messaging.quotes.enabled", false)) {
+            return true;
+        }
+
+        quote_table_ = std::make_unique<surveillance::QuoteTable>(
+            config_manager_->get<size_t>("messaging.quotes.table_capacity",
+                                         1 << 18));
+        pattern_detector_->set_quote_table(quote_table_.get());
+
+        auto quotes_config = config_manager_->get_section("messaging.quotes.kafka");
+        quote_consumer_ = std::make_unique<messaging::KafkaConsumer>(quotes_config);
+
+        // Single consumer thread per instrument stream keeps the quote
+        // table's one-writer-per-slot contract
+        quote_consumer_->set_quote_callback(
+            [this](const surveillance::QuoteUpdate& update) {
+                quote_table_->update(
+                    surveillance::StringInterner::instance().intern(
+                        update.instrument_symbol),
+                    update.top);
+            });
+
+        return quote_consumer_->initialize();
+    }
+
     bool initialize_kafka_consumer() {
         auto kafka_config = config_manager_->get_section("messaging.kafka");
         kafka_consumer_ = std::make_unique<messaging::KafkaConsumer>(kafka_config);
 
-        // Set trade callback
-        kafka_consumer_->set_trade_callback([this](const surveillance::TradeData& trade) {
-            if (!pattern_detector_->process_trade(trade)) {
-                spdlog::warn("Failed to process trade: {}", trade.trade_id);
-            }
-        });
+        // Clustered mode: consume exactly the partitions this node owns
+        // under the shard map instead of joining a consumer group blind
+        if (cluster_coordinator_) {
+            kafka_consumer_->assign_partitions(
+                cluster_coordinator_->owned_partitions());
+        }
+
+        bool binary_format =
+            config_manager_->get<bool>("messaging.kafka.binary_format", false);
+
+        if (binary_format) {
+            // Binary fast path: whole message batches decode straight into
+            // POD records and bypass per-trade string construction
+            kafka_consumer_->set_batch_callback(
+                [this](const void* payload, size_t size) {
+                    // Reused per ingest thread so decoding allocates nothing
+                    // in steady state
+                    thread_local std::vector<surveillance::TradeRecord> records;
+
+                    size_t decoded = messaging::BinaryTradeCodec::decode_batch(
+                        payload, size, records);
+                    if (decoded == 0) {
+                        return;
+                    }
+
+                    // Tee into the capture file before queueing so the tape
+                    // reflects everything offered to the detector
+                    if (capture_writer_) {
+                        for (const auto& record : records) {
+                            capture_writer_->append(record);
+                        }
+                    }
+
+                    size_t queued = pattern_detector_->process_records_batch(
+                        records.data(), records.size());
+                    if (queued < decoded) {
+                        spdlog::warn("Dropped {} of {} records from binary batch",
+                                     decoded - queued, decoded);
+                    }
+                });
+        } else {
+            // Legacy JSON path: one TradeData per message
+            kafka_consumer_->set_trade_callback([this](const surveillance::TradeData& trade) {
+                if (capture_writer_) {
+                    surveillance::TradeRecord record;
+                    surveillance::make_trade_record(trade, record);
+                    capture_writer_->append(record);
+                }
+
+                if (!pattern_detector_->process_trade(trade)) {
+                    spdlog::warn("Failed to process trade: {}", trade.trade_id);
+                }
+            });
+        }
 
         return kafka_consumer_->initialize();
     }
@@ -266,10 +814,28 @@ private:
         grpc_service_ = std::make_unique<grpc::SurveillanceService>(
             pattern_detector_.get(), grpc_config);
 
+        // Clustered mode: the stats endpoint reports the sum of every
+        // node's published counters, not just this box
+        if (cluster_coordinator_) {
+            grpc_service_->set_cluster_stats_provider([this] {
+                return cluster_coordinator_->aggregate_cluster_stats();
+            });
+        }
+
         return grpc_service_->initialize();
     }
 
     void handle_surveillance_alert(const surveillance::SurveillanceAlert& alert) {
+        // End-to-end latency against the ingress stamp carried through
+        // detection and the dispatcher - the number the soak tests gate on
+        if (alert.ingress_ns > 0) {
+            int64_t now = surveillance::ingress_now_ns();
+            if (now > alert.ingress_ns) {
+                alert_handler_latency_.record(
+                    static_cast<uint64_t>(now - alert.ingress_ns));
+            }
+        }
+
         try {
             // Log the alert
             spdlog::warn("Surveillance Alert - Type: {}, Severity: {}, Description: {}",
@@ -277,11 +843,13 @@ private:
                         static_cast<int>(alert.severity),
                         alert.description);
 
-            // Store alert in database
-            postgres_connection_->store_alert(alert);
+            // Hand off to the write-behind persistence stage; storage and
+            // caching happen in batches off the alert path
+            alert_writer_->enqueue(alert);
 
-            // Cache alert in Redis for real-time access
-            redis_connection_->cache_alert(alert);
+            // Fan out to streaming gRPC subscribers; each has its own
+            // bounded queue, so a slow stream cannot back us up
+            grpc_service_->publish_alert(alert);
 
             // Send notification if high severity
             if (alert.severity >= surveillance::AlertSeverity::HIGH) {
@@ -329,6 +897,14 @@ private:
         metrics_collector_->record_throughput(stats.throughput_trades_per_second);
         metrics_collector_->record_processing_time(stats.avg_processing_time_ns);
 
+        // End-to-end residency against the ingress stamp
+        metrics_collector_->record_residency(
+            "queue", stats.ingress_to_dequeue_p50_ns,
+            stats.ingress_to_dequeue_p99_ns);
+        metrics_collector_->record_residency(
+            "alert_dispatch", stats.ingress_to_dispatch_p50_ns,
+            stats.ingress_to_dispatch_p99_ns);
+
         // Collect system metrics
         metrics_collector_->record_memory_usage();
         metrics_collector_->record_cpu_usage();
@@ -339,6 +915,45 @@ private:
             metrics_collector_->record_database_connections(db_stats.active_connections);
             metrics_collector_->record_database_query_time(db_stats.avg_query_time_ms);
         }
+
+        // Per-pool depth and queue-to-completion latency
+        if (postgres_pool_) {
+            auto pool_stats = postgres_pool_->get_stats();
+            metrics_collector_->record_pool_depth("postgres", pool_stats.queue_depth);
+            metrics_collector_->record_pool_latency(
+                "postgres", pool_stats.p50_latency_ns, pool_stats.p99_latency_ns);
+        }
+        if (redis_pool_) {
+            auto pool_stats = redis_pool_->get_stats();
+            metrics_collector_->record_pool_depth("redis", pool_stats.queue_depth);
+            metrics_collector_->record_pool_latency(
+                "redis", pool_stats.p50_latency_ns, pool_stats.p99_latency_ns);
+        }
+
+        // Clustered mode: publish local counters for cluster-wide rollup
+        if (cluster_coordinator_) {
+            cluster_coordinator_->publish_local_stats(stats);
+        }
+
+        // Drain the hot-path trace rings off-path and act on any pattern
+        // that blew through its time budget
+        pattern_detector_->enforce_pattern_budgets();
+
+        auto trace = pattern_detector_->get_trace_report();
+        for (size_t i = 0;
+             i < static_cast<size_t>(surveillance::TraceStage::kStageCount); ++i) {
+            const auto& stage = trace.stages[i];
+            if (stage.samples == 0) {
+                continue;
+            }
+            metrics_collector_->record_stage_latency(
+                surveillance::trace_stage_name(static_cast<surveillance::TraceStage>(i)),
+                stage.total_ns / stage.samples, stage.max_ns);
+        }
+        for (const auto& detector : trace.detectors) {
+            metrics_collector_->record_pattern_latency(
+                detector.name, detector.total_ns / detector.samples, detector.max_ns);
+        }
     }
 
     void print_statistics() {
@@ -356,6 +971,64 @@ private:
         spdlog::info("Memory Usage: {:.2f} MB", 
                     stats.memory_usage_bytes / (1024.0 * 1024.0));
         spdlog::info("CPU Utilization: {:.1f}%", stats.cpu_utilization_percent);
+        spdlog::info("Context Store Occupancy: {:.1f}% ({} LRU evictions)",
+                    stats.context_store_occupancy * 100.0,
+                    stats.context_lru_evictions);
+        spdlog::info("Alert Lanes - High: {}, Low: {}, Collapsed: {}",
+                    stats.alert_high_lane_depth,
+                    stats.alert_low_lane_depth,
+                    stats.alerts_collapsed);
+        spdlog::info("Ingress - Rejected: {}, Duplicates Suppressed: {}",
+                    stats.trades_rejected,
+                    stats.duplicates_suppressed);
+        spdlog::info("Residency - Queue p50/p99: {:.1f}/{:.1f} μs, "
+                    "Alert Dispatch p50/p99: {:.1f}/{:.1f} μs",
+                    stats.ingress_to_dequeue_p50_ns / 1000.0,
+                    stats.ingress_to_dequeue_p99_ns / 1000.0,
+                    stats.ingress_to_dispatch_p50_ns / 1000.0,
+                    stats.ingress_to_dispatch_p99_ns / 1000.0);
+        std::array<uint64_t, surveillance::LatencyHistogram::kBucketCount>
+            handler_counts{};
+        alert_handler_latency_.accumulate_into(handler_counts);
+        auto handler_p99 =
+            surveillance::LatencyHistogram::quantile(handler_counts, 0.99);
+        if (handler_p99 > 0) {
+            spdlog::info("End-to-End Alert Latency p50/p99: {:.1f}/{:.1f} μs",
+                        surveillance::LatencyHistogram::quantile(handler_counts, 0.50) / 1000.0,
+                        handler_p99 / 1000.0);
+        }
+        if (quote_table_) {
+            spdlog::info("Quotes - Updates: {}, Unquoted Reads: {}, Capacity Drops: {}",
+                        quote_table_->updates(),
+                        quote_table_->read_misses(),
+                        quote_table_->capacity_misses());
+        }
+        if (cluster_coordinator_) {
+            auto cluster = cluster_coordinator_->aggregate_cluster_stats();
+            spdlog::info("Cluster - Nodes: {}, Trades: {}, Alerts: {}, "
+                        "Throughput: {:.2f} trades/sec",
+                        cluster.nodes_reporting,
+                        cluster.total_trades_processed,
+                        cluster.total_alerts_generated,
+                        cluster.throughput_trades_per_second);
+        }
+        if (postgres_pool_ && redis_pool_) {
+            auto pg_stats = postgres_pool_->get_stats();
+            auto redis_stats = redis_pool_->get_stats();
+            spdlog::info("DB Pools - PG depth: {}, p99: {:.2f} ms; Redis depth: {}, p99: {:.2f} ms",
+                        pg_stats.queue_depth,
+                        pg_stats.p99_latency_ns / 1e6,
+                        redis_stats.queue_depth,
+                        redis_stats.p99_latency_ns / 1e6);
+        }
+        if (trade_archiver_) {
+            auto archive_stats = trade_archiver_->get_stats();
+            spdlog::info("Archival - Rows: {}, Blocks: {}, Pending: {}, Dropped: {}",
+                        archive_stats.rows_archived,
+                        archive_stats.blocks_flushed,
+                        archive_stats.pending_blocks,
+                        archive_stats.blocks_dropped);
+        }
         
         // Print per-pattern statistics
         if (!stats.pattern_alerts_count.empty()) {
@@ -376,16 +1049,22 @@ private:
         static auto last_cleanup = std::chrono::steady_clock::now();
         auto now = std::chrono::steady_clock::now();
         
-        // Cleanup old data every hour
+        // Cleanup old data every hour. Both sweeps run as async pool jobs
+        // pinned to the last lane, so the archive scan that used to spike
+        // alert p99 50x never touches the lanes the alert path flushes on
         if (now - last_cleanup >= std::chrono::hours(1)) {
-            // Clean up old cache entries
-            redis_connection_->cleanup_expired_entries();
-            
-            // Archive old alerts
-            postgres_connection_->archive_old_alerts();
-            
+            redis_pool_->submit_to(redis_pool_->size() - 1,
+                [](database::RedisConnection& redis) {
+                    redis.cleanup_expired_entries();
+                });
+
+            postgres_pool_->submit_to(postgres_pool_->size() - 1,
+                [](database::PostgresConnection& postgres) {
+                    postgres.archive_old_alerts();
+                    spdlog::info("Performed periodic maintenance");
+                });
+
             last_cleanup = now;
-            spdlog::info("Performed periodic maintenance");
         }
     }
 };
@@ -399,6 +1078,14 @@ int main(int argc, char* argv[]) {
             ("config,c", po::value<std::string>()->default_value("config/engine.json"), 
              "Configuration file path")
             ("daemon,d", "Run as daemon")
+            ("replay,r", po::value<std::string>(),
+             "Replay a trade capture file instead of consuming Kafka")
+            ("replay-timing", "Reproduce original inter-trade timing during replay")
+            ("backtest,b", po::value<std::string>(),
+             "Run a detector backtest over a capture file and exit")
+            ("backtest-variant", po::value<std::vector<std::string>>()->composing(),
+             "Backtest variant as name=config.json[:profile]; repeatable, "
+             "first is the baseline")
             ("version,v", "Show version information");
 
         po::variables_map vm;
@@ -416,13 +1103,53 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
+        // Offline backtest: no engine, no databases, no Kafka - just the
+        // production detector stack over an archived tape, once per
+        // config variant, with an alert diff against the baseline
+        if (vm.count("backtest")) {
+            std::vector<surveillance::BacktestRunner::Variant> variants;
+            if (vm.count("backtest-variant")) {
+                for (const auto& spec :
+                     vm["backtest-variant"].as<std::vector<std::string>>()) {
+                    auto eq = spec.find('=');
+                    if (eq == std::string::npos) {
+                        std::cerr << "Bad variant spec (want name=config"
+                                     "[:profile]): " << spec << std::endl;
+                        return 1;
+                    }
+                    surveillance::BacktestRunner::Variant variant;
+                    variant.name = spec.substr(0, eq);
+                    auto rest = spec.substr(eq + 1);
+                    auto colon = rest.find(':');
+                    variant.config_path = rest.substr(0, colon);
+                    if (colon != std::string::npos) {
+                        variant.detector_profile = rest.substr(colon + 1);
+                    }
+                    variants.push_back(std::move(variant));
+                }
+            } else {
+                variants.push_back({"baseline",
+                                    vm["config"].as<std::string>(), ""});
+            }
+
+            surveillance::BacktestRunner runner({});
+            if (!runner.run(vm["backtest"].as<std::string>(), variants)) {
+                return 1;
+            }
+            runner.print_report();
+            return 0;
+        }
+
         // Set up signal handlers for graceful shutdown
         signal(SIGINT, signal_handler);
         signal(SIGTERM, signal_handler);
 
         // Initialize and start the engine
         DharmaGuardEngine engine;
-        
+
+        bool replay_requested = vm.count("replay") > 0;
+        engine.set_replay_mode(replay_requested);
+
         std::string config_file = vm["config"].as<std::string>();
         if (!engine.initialize(config_file)) {
             std::cerr << "Failed to initialize DharmaGuard Engine" << std::endl;
@@ -434,6 +1161,14 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
+        if (replay_requested) {
+            // Stream the capture through the pipeline, then shut down
+            bool ok = engine.replay(vm["replay"].as<std::string>(),
+                                    vm.count("replay-timing") > 0);
+            engine.stop();
+            return ok ? 0 : 1;
+        }
+
         // Run the main loop
         engine.run();
 
@@ -0,0 +1,167 @@
+#include "messaging/binary_trade_codec.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace dharmaguard {
+namespace messaging {
+
+namespace {
+
+// Interpret a fixed-width NUL-padded wire field as a string_view
+template <size_t N>
+std::string_view wire_field(const char (&field)[N]) {
+    size_t length = 0;
+    while (length < N && field[length] != '\0') {
+        ++length;
+    }
+    return std::string_view(field, length);
+}
+
+// Copy a wire field into an inline record array, truncating if needed
+template <size_t N>
+void copy_wire_field(char (&dest)[surveillance::TradeRecord::kInlineIdCapacity],
+                     const char (&src)[N]) {
+    auto view = wire_field(src);
+    size_t length = std::min(view.size(),
+                             surveillance::TradeRecord::kInlineIdCapacity - 1);
+    std::memcpy(dest, view.data(), length);
+    dest[length] = '\0';
+}
+
+template <size_t N>
+void copy_to_wire(char (&dest)[N], std::string_view src) {
+    size_t length = std::min(src.size(), N - 1);
+    std::memset(dest, 0, N);
+    std::memcpy(dest, src.data(), length);
+}
+
+} // namespace
+
+size_t BinaryTradeCodec::decode_batch(const void* payload, size_t size,
+                                      std::vector<surveillance::TradeRecord>& records) {
+    records.clear();
+
+    if (size < sizeof(WireBatchHeader)) {
+        spdlog::warn("Binary trade batch shorter than header: {} bytes", size);
+        return 0;
+    }
+
+    WireBatchHeader header;
+    std::memcpy(&header, payload, sizeof(header));
+
+    if (header.magic != WireBatchHeader::kMagic) {
+        spdlog::warn("Binary trade batch has bad magic: {:#x}", header.magic);
+        return 0;
+    }
+    if (header.version != WireBatchHeader::kVersion) {
+        spdlog::warn("Unsupported binary trade batch version: {}", header.version);
+        return 0;
+    }
+
+    size_t expected = sizeof(WireBatchHeader) +
+                      static_cast<size_t>(header.record_count) * sizeof(WireTradeRecord);
+    if (size < expected) {
+        spdlog::warn("Truncated binary trade batch: {} of {} bytes", size, expected);
+        return 0;
+    }
+
+    const uint8_t* cursor = static_cast<const uint8_t*>(payload) + sizeof(WireBatchHeader);
+    records.resize(header.record_count);
+
+    // Ingress stamp for end-to-end latency: the whole batch arrived in one
+    // Kafka message, so one clock read covers every record in it
+    const int64_t ingress_ns = surveillance::ingress_now_ns();
+
+    for (uint32_t i = 0; i < header.record_count; ++i) {
+        WireTradeRecord wire;
+        std::memcpy(&wire, cursor, sizeof(wire));
+        decode_record(wire, records[i]);
+        records[i].ingress_ns = ingress_ns;
+        cursor += sizeof(WireTradeRecord);
+    }
+
+    return records.size();
+}
+
+void BinaryTradeCodec::decode_record(const WireTradeRecord& wire,
+                                     surveillance::TradeRecord& record) {
+    auto& interner = surveillance::StringInterner::instance();
+
+    copy_wire_field(record.trade_id, wire.trade_id);
+    copy_wire_field(record.order_id, wire.order_id);
+
+    record.instrument_id = interner.intern(wire_field(wire.instrument_symbol));
+    record.account_id = interner.intern(wire_field(wire.account_id));
+    record.client_id = interner.intern(wire_field(wire.client_id));
+    record.exchange_id = interner.intern(wire_field(wire.exchange));
+    record.trader_id = interner.intern(wire_field(wire.trader_id));
+
+    record.trade_type = static_cast<surveillance::TradeData::TradeType>(wire.trade_type);
+    record.segment = static_cast<surveillance::TradeData::MarketSegment>(wire.segment);
+    record.is_own_account = wire.is_own_account != 0;
+
+    record.quantity = wire.quantity;
+    record.price = wire.price;
+    record.value = wire.value;
+    record.brokerage = wire.brokerage;
+    record.taxes = wire.taxes;
+    record.timestamp = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(wire.timestamp_ns)));
+
+    // Not on the wire; callers stamp their own ingress boundary (the batch
+    // decoder above, the replay loop, the backtest feed)
+    record.ingress_ns = 0;
+}
+
+void BinaryTradeCodec::encode_batch(const std::vector<surveillance::TradeRecord>& records,
+                                    std::vector<uint8_t>& payload) {
+    payload.clear();
+    payload.resize(sizeof(WireBatchHeader) + records.size() * sizeof(WireTradeRecord));
+
+    WireBatchHeader header;
+    header.magic = WireBatchHeader::kMagic;
+    header.version = WireBatchHeader::kVersion;
+    header.flags = 0;
+    header.record_count = static_cast<uint32_t>(records.size());
+    std::memcpy(payload.data(), &header, sizeof(header));
+
+    uint8_t* cursor = payload.data() + sizeof(WireBatchHeader);
+    for (const auto& record : records) {
+        WireTradeRecord wire{};
+        encode_record(record, wire);
+        std::memcpy(cursor, &wire, sizeof(wire));
+        cursor += sizeof(WireTradeRecord);
+    }
+}
+
+void BinaryTradeCodec::encode_record(const surveillance::TradeRecord& record,
+                                     WireTradeRecord& wire) {
+    auto& interner = surveillance::StringInterner::instance();
+
+    copy_to_wire(wire.trade_id, record.trade_id);
+    copy_to_wire(wire.order_id, record.order_id);
+    copy_to_wire(wire.instrument_symbol, interner.resolve(record.instrument_id));
+    copy_to_wire(wire.account_id, interner.resolve(record.account_id));
+    copy_to_wire(wire.client_id, interner.resolve(record.client_id));
+    copy_to_wire(wire.exchange, interner.resolve(record.exchange_id));
+    copy_to_wire(wire.trader_id, interner.resolve(record.trader_id));
+
+    wire.trade_type = static_cast<uint8_t>(record.trade_type);
+    wire.segment = static_cast<uint8_t>(record.segment);
+    wire.is_own_account = record.is_own_account ? 1 : 0;
+
+    wire.quantity = record.quantity;
+    wire.price = record.price;
+    wire.value = record.value;
+    wire.brokerage = record.brokerage;
+    wire.taxes = record.taxes;
+    wire.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        record.timestamp.time_since_epoch()).count();
+}
+
+} // namespace messaging
+} // namespace dharmaguard
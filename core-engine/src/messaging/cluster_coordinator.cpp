@@ -0,0 +1,343 @@
+#include "messaging/cluster_coordinator.hpp"
+
+#include <boost/json.hpp>
+#include <spdlog/spdlog.h>
+
+namespace dharmaguard {
+namespace messaging {
+
+namespace json = boost::json;
+
+std::string ShardMap::to_json() const {
+    json::object root;
+    root["version"] = version;
+    root["kafka_partitions"] = kafka_partitions;
+
+    json::array owners;
+    for (uint32_t owner : partition_owners) {
+        owners.push_back(owner);
+    }
+    root["partition_owners"] = std::move(owners);
+
+    json::object groups;
+    for (const auto& [symbol, group] : correlation_groups) {
+        groups[symbol] = group;
+    }
+    root["correlation_groups"] = std::move(groups);
+
+    return json::serialize(root);
+}
+
+std::optional<ShardMap> ShardMap::from_json(const std::string& text) {
+    try {
+        auto root = json::parse(text).as_object();
+
+        ShardMap map;
+        map.version = root.at("version").to_number<uint64_t>();
+        map.kafka_partitions = root.at("kafka_partitions").to_number<uint32_t>();
+
+        for (const auto& owner : root.at("partition_owners").as_array()) {
+            map.partition_owners.push_back(owner.to_number<uint32_t>());
+        }
+        for (const auto& entry : root.at("correlation_groups").as_object()) {
+            map.correlation_groups[std::string(entry.key())] =
+                std::string(entry.value().as_string());
+        }
+
+        if (map.partition_owners.size() != map.kafka_partitions) {
+            spdlog::error("Shard map owner count {} != partition count {}",
+                          map.partition_owners.size(), map.kafka_partitions);
+            return std::nullopt;
+        }
+        return map;
+    } catch (const std::exception& e) {
+        spdlog::error("Error parsing shard map: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+ClusterCoordinator::ClusterCoordinator(database::RedisConnection* redis,
+                                       Config config)
+    : redis_(redis)
+    , config_(std::move(config))
+{
+}
+
+ClusterCoordinator::~ClusterCoordinator() {
+    if (running_.load()) {
+        stop();
+    }
+}
+
+void ClusterCoordinator::declare_correlation_group(
+    const std::string& group, const std::vector<std::string>& instruments) {
+    if (running_.load()) {
+        spdlog::warn("Correlation groups must be declared before start(), ignoring");
+        return;
+    }
+    for (const auto& symbol : instruments) {
+        pending_groups_[symbol] = group;
+    }
+}
+
+bool ClusterCoordinator::start() {
+    if (running_.load()) {
+        spdlog::warn("ClusterCoordinator is already running");
+        return false;
+    }
+
+    // Adopt the published map if one exists; otherwise the lowest node
+    // derives the initial assignment from its config and publishes it.
+    // Locally declared correlation groups are merged in either case and
+    // republished with a version bump so the other nodes converge.
+    try {
+        ShardMap map;
+        auto published = redis_->get_value(config_.map_key);
+        if (published) {
+            auto parsed = ShardMap::from_json(*published);
+            if (!parsed) {
+                return false;
+            }
+            map = std::move(*parsed);
+        } else {
+            map = build_default_map();
+        }
+
+        bool groups_added = false;
+        for (const auto& [symbol, group] : pending_groups_) {
+            auto [it, inserted] = map.correlation_groups.emplace(symbol, group);
+            groups_added |= inserted || it->second != group;
+            it->second = group;
+        }
+
+        if (!published || (groups_added && config_.node_id == 0)) {
+            ++map.version;
+            redis_->set_value(config_.map_key, map.to_json());
+        }
+
+        {
+            std::unique_lock lock(map_mutex_);
+            map_ = std::move(map);
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("Error obtaining cluster shard map: {}", e.what());
+        return false;
+    }
+
+    running_.store(true);
+    refresh_thread_ = std::thread(&ClusterCoordinator::refresh_thread_func, this);
+
+    spdlog::info("ClusterCoordinator started - node {}/{}, map version {}, "
+                 "{} partitions ({} owned), {} correlated instruments",
+                 config_.node_id, config_.total_nodes, map_version(),
+                 config_.kafka_partitions, owned_partitions().size(),
+                 pending_groups_.size());
+    return true;
+}
+
+void ClusterCoordinator::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    running_.store(false);
+    if (refresh_thread_.joinable()) {
+        refresh_thread_.join();
+    }
+
+    spdlog::info("ClusterCoordinator stopped - final map version {}", map_version());
+}
+
+uint32_t ClusterCoordinator::partition_for(
+    const std::string& instrument_symbol) const {
+    std::shared_lock lock(map_mutex_);
+
+    // Correlated instruments hash through their group key so the whole
+    // group lands on one partition
+    const std::string* key = &instrument_symbol;
+    auto group = map_.correlation_groups.find(instrument_symbol);
+    if (group != map_.correlation_groups.end()) {
+        key = &group->second;
+    }
+
+    uint32_t partitions = map_.kafka_partitions ? map_.kafka_partitions : 1;
+    return static_cast<uint32_t>(hash_key(*key) % partitions);
+}
+
+bool ClusterCoordinator::owns_instrument(
+    const std::string& instrument_symbol) const {
+    uint32_t partition = partition_for(instrument_symbol);
+
+    std::shared_lock lock(map_mutex_);
+    if (partition >= map_.partition_owners.size()) {
+        return true;
+    }
+    return map_.partition_owners[partition] == config_.node_id;
+}
+
+std::vector<int32_t> ClusterCoordinator::owned_partitions() const {
+    std::shared_lock lock(map_mutex_);
+
+    std::vector<int32_t> partitions;
+    for (size_t i = 0; i < map_.partition_owners.size(); ++i) {
+        if (map_.partition_owners[i] == config_.node_id) {
+            partitions.push_back(static_cast<int32_t>(i));
+        }
+    }
+    return partitions;
+}
+
+void ClusterCoordinator::set_rebalance_callback(RebalanceCallback callback) {
+    rebalance_callback_ = std::move(callback);
+}
+
+void ClusterCoordinator::publish_local_stats(
+    const surveillance::ProcessingStats& stats) {
+    json::object root;
+    root["total_trades_processed"] = stats.total_trades_processed;
+    root["total_alerts_generated"] = stats.total_alerts_generated;
+    root["throughput_trades_per_second"] = stats.throughput_trades_per_second;
+    root["trades_rejected"] = stats.trades_rejected;
+    root["duplicates_suppressed"] = stats.duplicates_suppressed;
+
+    json::object patterns;
+    for (const auto& [pattern, count] : stats.pattern_alerts_count) {
+        patterns[pattern] = count;
+    }
+    root["pattern_alerts_count"] = std::move(patterns);
+
+    try {
+        // Short TTL so a dead node ages out of the aggregate instead of
+        // contributing stale counters forever
+        redis_->set_value(config_.stats_key_prefix +
+                              std::to_string(config_.node_id),
+                          json::serialize(root), std::chrono::seconds(30));
+    } catch (const std::exception& e) {
+        spdlog::error("Error publishing cluster stats: {}", e.what());
+    }
+}
+
+ClusterStats ClusterCoordinator::aggregate_cluster_stats() const {
+    ClusterStats cluster;
+
+    for (uint32_t node = 0; node < config_.total_nodes; ++node) {
+        std::optional<std::string> text;
+        try {
+            text = redis_->get_value(config_.stats_key_prefix +
+                                     std::to_string(node));
+        } catch (const std::exception& e) {
+            spdlog::error("Error fetching stats for node {}: {}", node, e.what());
+            continue;
+        }
+        if (!text) {
+            continue;
+        }
+
+        try {
+            auto root = json::parse(*text).as_object();
+            cluster.total_trades_processed +=
+                root.at("total_trades_processed").to_number<uint64_t>();
+            cluster.total_alerts_generated +=
+                root.at("total_alerts_generated").to_number<uint64_t>();
+            cluster.throughput_trades_per_second +=
+                root.at("throughput_trades_per_second").to_number<double>();
+            cluster.trades_rejected +=
+                root.at("trades_rejected").to_number<uint64_t>();
+            cluster.duplicates_suppressed +=
+                root.at("duplicates_suppressed").to_number<uint64_t>();
+            for (const auto& entry :
+                 root.at("pattern_alerts_count").as_object()) {
+                cluster.pattern_alerts_count[std::string(entry.key())] +=
+                    entry.value().to_number<uint64_t>();
+            }
+            ++cluster.nodes_reporting;
+        } catch (const std::exception& e) {
+            spdlog::error("Error parsing stats for node {}: {}", node, e.what());
+        }
+    }
+    return cluster;
+}
+
+uint64_t ClusterCoordinator::map_version() const {
+    std::shared_lock lock(map_mutex_);
+    return map_.version;
+}
+
+ShardMap ClusterCoordinator::build_default_map() const {
+    ShardMap map;
+    map.version = 0;
+    map.kafka_partitions = config_.kafka_partitions;
+    map.partition_owners.resize(config_.kafka_partitions);
+    for (uint32_t p = 0; p < config_.kafka_partitions; ++p) {
+        map.partition_owners[p] = p % std::max<uint32_t>(config_.total_nodes, 1);
+    }
+    return map;
+}
+
+void ClusterCoordinator::refresh_thread_func() {
+    spdlog::debug("Cluster refresh thread started");
+
+    auto last_poll = std::chrono::steady_clock::now();
+
+    while (running_.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_poll < config_.refresh_interval) {
+            continue;
+        }
+        last_poll = now;
+
+        try {
+            auto published = redis_->get_value(config_.map_key);
+            if (!published) {
+                continue;
+            }
+            auto fetched = ShardMap::from_json(*published);
+            if (fetched) {
+                adopt_if_newer(*fetched);
+            }
+        } catch (const std::exception& e) {
+            spdlog::error("Error refreshing cluster shard map: {}", e.what());
+        }
+    }
+
+    spdlog::debug("Cluster refresh thread finished");
+}
+
+bool ClusterCoordinator::adopt_if_newer(const ShardMap& fetched) {
+    ShardMap previous;
+    {
+        std::unique_lock lock(map_mutex_);
+        if (fetched.version <= map_.version) {
+            return false;
+        }
+        previous = map_;
+        map_ = fetched;
+    }
+
+    spdlog::info("Cluster shard map updated: version {} -> {}, {} owned partitions",
+                 previous.version, fetched.version, owned_partitions().size());
+
+    if (rebalance_callback_) {
+        try {
+            rebalance_callback_(previous, fetched);
+        } catch (const std::exception& e) {
+            spdlog::error("Error in rebalance callback: {}", e.what());
+        }
+    }
+    return true;
+}
+
+uint64_t ClusterCoordinator::hash_key(const std::string& key) {
+    // FNV-1a, same construction the trade deduper uses
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace messaging
+} // namespace dharmaguard
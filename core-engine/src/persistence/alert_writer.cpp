@@ -0,0 +1,248 @@
+#include "persistence/alert_writer.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace dharmaguard {
+namespace persistence {
+
+AlertWriter::AlertWriter(database::PostgresConnection* postgres,
+                         database::RedisConnection* redis,
+                         Config config)
+    : postgres_(postgres)
+    , redis_(redis)
+    , config_(std::move(config))
+{
+}
+
+AlertWriter::~AlertWriter() {
+    if (running_.load()) {
+        stop();
+    }
+}
+
+bool AlertWriter::start() {
+    if (running_.load()) {
+        spdlog::warn("AlertWriter is already running");
+        return false;
+    }
+
+    running_.store(true);
+    writer_thread_ = std::thread(&AlertWriter::writer_thread_func, this);
+
+    spdlog::info("AlertWriter started - batch size: {}, flush interval: {} ms",
+                 config_.max_batch_size, config_.flush_interval.count());
+    return true;
+}
+
+void AlertWriter::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    running_.store(false);
+    if (writer_thread_.joinable()) {
+        writer_thread_.join();
+    }
+
+    auto stats = get_stats();
+    spdlog::info("AlertWriter stopped - persisted: {}, spilled: {}, flushes: {}",
+                 stats.alerts_persisted, stats.alerts_spilled, stats.flush_count);
+}
+
+void AlertWriter::set_connection_pools(
+    database::ConnectionPool<database::PostgresConnection>* postgres_pool,
+    database::ConnectionPool<database::RedisConnection>* redis_pool) {
+    if (running_.load()) {
+        spdlog::warn("AlertWriter pools must be attached before start()");
+        return;
+    }
+    postgres_pool_ = postgres_pool;
+    redis_pool_ = redis_pool;
+}
+
+bool AlertWriter::enqueue(const surveillance::SurveillanceAlert& alert) {
+    if (queue_depth_.load(std::memory_order_relaxed) >= config_.max_queue_depth) {
+        // Overflow: journal to disk rather than blocking or growing the
+        // in-memory queue unbounded during an alert storm
+        spill_to_disk(alert);
+        return false;
+    }
+
+    queue_.push(alert);
+    queue_depth_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+AlertWriter::Stats AlertWriter::get_stats() const {
+    Stats stats;
+    stats.alerts_persisted = alerts_persisted_.load(std::memory_order_relaxed);
+    stats.alerts_spilled = alerts_spilled_.load(std::memory_order_relaxed);
+    stats.alerts_replayed = alerts_replayed_.load(std::memory_order_relaxed);
+    stats.flush_count = flush_count_.load(std::memory_order_relaxed);
+    stats.queue_depth = queue_depth_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void AlertWriter::writer_thread_func() {
+    spdlog::debug("AlertWriter thread started");
+
+    std::vector<surveillance::SurveillanceAlert> batch;
+    batch.reserve(config_.max_batch_size);
+
+    auto last_flush = std::chrono::steady_clock::now();
+
+    while (running_.load() || queue_depth_.load(std::memory_order_relaxed) > 0) {
+        surveillance::SurveillanceAlert alert;
+        while (batch.size() < config_.max_batch_size && queue_.try_pop(alert)) {
+            queue_depth_.fetch_sub(1, std::memory_order_relaxed);
+            batch.push_back(std::move(alert));
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        bool size_trigger = batch.size() >= config_.max_batch_size;
+        bool time_trigger = !batch.empty() && (now - last_flush) >= config_.flush_interval;
+
+        if (size_trigger || time_trigger || (!running_.load() && !batch.empty())) {
+            flush_batch(batch);
+            last_flush = now;
+
+            // Use quiet flush cycles to drain the overflow journal
+            if (!size_trigger) {
+                replay_spilled(config_.max_batch_size);
+            }
+        } else {
+            // No trigger fired: sleep rather than spinning on try_pop
+            // while a partial batch waits out the flush interval. Wake by
+            // the time the flush comes due, at most 1 ms so fresh alerts
+            // keep getting folded into the batch
+            auto nap = std::chrono::milliseconds(1);
+            if (!batch.empty()) {
+                auto until_due = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    config_.flush_interval - (now - last_flush));
+                nap = std::clamp(until_due, std::chrono::milliseconds(0), nap);
+            }
+            std::this_thread::sleep_for(nap);
+        }
+    }
+
+    // stop() can land between the trigger check and the loop condition,
+    // leaving the last partial batch staged; flush it before exiting
+    flush_batch(batch);
+
+    spdlog::debug("AlertWriter thread finished");
+}
+
+void AlertWriter::flush_batch(std::vector<surveillance::SurveillanceAlert>& batch) {
+    if (batch.empty()) {
+        return;
+    }
+
+    if (postgres_pool_ && redis_pool_) {
+        // Hand the batch to both pools at once so the Postgres insert and
+        // the Redis pipeline overlap instead of running back to back, and
+        // the writer thread moves straight on to the next batch
+        auto shared = std::make_shared<std::vector<surveillance::SurveillanceAlert>>(
+            std::move(batch));
+        bool pg_queued = postgres_pool_->submit(
+            [this, shared](database::PostgresConnection& postgres) {
+                postgres.store_alerts_batch(*shared);
+                // Counted on completion of the store, not at submit: a
+                // rejected or failed flush must not inflate the persisted
+                // counter - pool saturation is what this stat exposes
+                alerts_persisted_.fetch_add(shared->size(),
+                                            std::memory_order_relaxed);
+            });
+        bool redis_queued = redis_pool_->submit(
+            [shared](database::RedisConnection& redis) {
+                redis.cache_alerts_pipelined(*shared);
+            });
+        if (!pg_queued || !redis_queued) {
+            spdlog::error("Connection pool rejected alert flush of {} alerts",
+                          shared->size());
+        }
+
+        flush_count_.fetch_add(1, std::memory_order_relaxed);
+        batch.clear();
+        return;
+    }
+
+    try {
+        // Single COPY/multi-row insert instead of one round trip per alert
+        postgres_->store_alerts_batch(batch);
+    } catch (const std::exception& e) {
+        spdlog::error("Postgres batch flush failed for {} alerts: {}",
+                      batch.size(), e.what());
+    }
+
+    try {
+        // One pipelined round trip for the whole batch
+        redis_->cache_alerts_pipelined(batch);
+    } catch (const std::exception& e) {
+        spdlog::error("Redis pipeline flush failed for {} alerts: {}",
+                      batch.size(), e.what());
+    }
+
+    alerts_persisted_.fetch_add(batch.size(), std::memory_order_relaxed);
+    flush_count_.fetch_add(1, std::memory_order_relaxed);
+    batch.clear();
+}
+
+void AlertWriter::spill_to_disk(const surveillance::SurveillanceAlert& alert) {
+    std::lock_guard<std::mutex> lock(spill_mutex_);
+
+    std::ofstream journal(config_.spill_path, std::ios::app);
+    if (!journal.is_open()) {
+        spdlog::error("Cannot open alert spill journal: {}", config_.spill_path);
+        return;
+    }
+
+    journal << alert.to_json() << "\n";
+    alerts_spilled_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AlertWriter::replay_spilled(size_t budget) {
+    std::lock_guard<std::mutex> lock(spill_mutex_);
+
+    std::ifstream journal(config_.spill_path);
+    if (!journal.is_open()) {
+        return;
+    }
+
+    std::vector<surveillance::SurveillanceAlert> replayed;
+    std::vector<std::string> remaining;
+    std::string line;
+
+    while (std::getline(journal, line)) {
+        if (replayed.size() < budget) {
+            replayed.push_back(surveillance::SurveillanceAlert::from_json(line));
+        } else {
+            remaining.push_back(line);
+        }
+    }
+    journal.close();
+
+    if (replayed.empty()) {
+        return;
+    }
+
+    // Rewrite the journal with whatever exceeded this cycle's budget
+    std::ofstream rewrite(config_.spill_path, std::ios::trunc);
+    for (const auto& entry : remaining) {
+        rewrite << entry << "\n";
+    }
+    rewrite.close();
+
+    for (const auto& alert : replayed) {
+        queue_.push(alert);
+        queue_depth_.fetch_add(1, std::memory_order_relaxed);
+    }
+    alerts_replayed_.fetch_add(replayed.size(), std::memory_order_relaxed);
+
+    spdlog::info("Replayed {} spilled alerts from journal", replayed.size());
+}
+
+} // namespace persistence
+} // namespace dharmaguard
@@ -0,0 +1,197 @@
+#include "persistence/trade_archiver.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace dharmaguard {
+namespace persistence {
+
+void TradeColumnBlock::reserve(size_t capacity) {
+    timestamps_ns.reserve(capacity);
+    prices.reserve(capacity);
+    values.reserve(capacity);
+    quantities.reserve(capacity);
+    instrument_ids.reserve(capacity);
+    account_ids.reserve(capacity);
+    client_ids.reserve(capacity);
+    exchange_ids.reserve(capacity);
+    trader_ids.reserve(capacity);
+    trade_types.reserve(capacity);
+    segments.reserve(capacity);
+}
+
+void TradeColumnBlock::clear() {
+    timestamps_ns.clear();
+    prices.clear();
+    values.clear();
+    quantities.clear();
+    instrument_ids.clear();
+    account_ids.clear();
+    client_ids.clear();
+    exchange_ids.clear();
+    trader_ids.clear();
+    trade_types.clear();
+    segments.clear();
+}
+
+void TradeColumnBlock::append(const surveillance::TradeRecord& record) {
+    timestamps_ns.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        record.timestamp.time_since_epoch()).count());
+    prices.push_back(record.price);
+    values.push_back(record.value);
+    quantities.push_back(record.quantity);
+    instrument_ids.push_back(record.instrument_id);
+    account_ids.push_back(record.account_id);
+    client_ids.push_back(record.client_id);
+    exchange_ids.push_back(record.exchange_id);
+    trader_ids.push_back(record.trader_id);
+    trade_types.push_back(static_cast<uint8_t>(record.trade_type));
+    segments.push_back(static_cast<uint8_t>(record.segment));
+}
+
+TradeArchiver::TradeArchiver(database::ClickHouseConnection* clickhouse,
+                             size_t num_shards,
+                             Config config)
+    : clickhouse_(clickhouse)
+    , config_(std::move(config))
+    , shard_buffers_(num_shards)
+{
+    for (auto& buffer : shard_buffers_) {
+        buffer.active = std::make_unique<TradeColumnBlock>();
+        buffer.active->reserve(config_.block_rows);
+    }
+}
+
+TradeArchiver::~TradeArchiver() {
+    if (running_.load()) {
+        stop();
+    }
+}
+
+bool TradeArchiver::start() {
+    if (running_.load()) {
+        spdlog::warn("TradeArchiver already running");
+        return false;
+    }
+
+    running_.store(true);
+    flush_thread_ = std::thread(&TradeArchiver::flush_thread_func, this);
+
+    spdlog::info("TradeArchiver started: {} rows/block into table {}",
+                 config_.block_rows, config_.table);
+    return true;
+}
+
+void TradeArchiver::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    // Seal whatever the workers left behind. Workers must be stopped (or
+    // quiescent) by now - the detector shuts down before its sinks.
+    for (size_t i = 0; i < shard_buffers_.size(); ++i) {
+        if (shard_buffers_[i].active->rows() > 0) {
+            seal_block(i);
+        }
+    }
+
+    running_.store(false);
+    flush_cv_.notify_one();
+    if (flush_thread_.joinable()) {
+        flush_thread_.join();
+    }
+
+    spdlog::info("TradeArchiver stopped: {} rows in {} blocks archived, {} dropped",
+                 rows_archived_.load(), blocks_flushed_.load(), blocks_dropped_.load());
+}
+
+void TradeArchiver::append(size_t shard_index, const surveillance::TradeRecord& record) {
+    ShardBuffer& buffer = shard_buffers_[shard_index];
+
+    if (buffer.active->rows() == 0) {
+        buffer.first_append = std::chrono::steady_clock::now();
+    }
+
+    buffer.active->append(record);
+
+    // Seal on size, or on age so low-traffic shards still land within the
+    // freshness bound
+    if (buffer.active->rows() >= config_.block_rows ||
+        std::chrono::steady_clock::now() - buffer.first_append >= config_.max_block_age) {
+        seal_block(shard_index);
+    }
+}
+
+void TradeArchiver::seal_block(size_t shard_index) {
+    ShardBuffer& buffer = shard_buffers_[shard_index];
+
+    // Shed the oldest pending block rather than stall the worker; the
+    // drop counter is the signal that ClickHouse is not keeping up
+    if (pending_count_.load(std::memory_order_relaxed) >= config_.max_pending_blocks) {
+        std::unique_ptr<TradeColumnBlock> dropped;
+        if (pending_.try_pop(dropped)) {
+            pending_count_.fetch_sub(1, std::memory_order_relaxed);
+            blocks_dropped_.fetch_add(1, std::memory_order_relaxed);
+            dropped->clear();
+            free_list_.push(std::move(dropped));
+        }
+    }
+
+    std::unique_ptr<TradeColumnBlock> sealed = std::move(buffer.active);
+    buffer.active = take_block();
+
+    pending_.push(std::move(sealed));
+    pending_count_.fetch_add(1, std::memory_order_relaxed);
+    flush_cv_.notify_one();
+}
+
+std::unique_ptr<TradeColumnBlock> TradeArchiver::take_block() {
+    std::unique_ptr<TradeColumnBlock> block;
+    if (!free_list_.try_pop(block)) {
+        block = std::make_unique<TradeColumnBlock>();
+        block->reserve(config_.block_rows);
+    }
+    return block;
+}
+
+void TradeArchiver::flush_thread_func() {
+    spdlog::debug("TradeArchiver flush thread started");
+
+    while (running_.load() || pending_count_.load(std::memory_order_relaxed) > 0) {
+        std::unique_ptr<TradeColumnBlock> block;
+        if (!pending_.try_pop(block)) {
+            std::unique_lock<std::mutex> lock(flush_mutex_);
+            flush_cv_.wait_for(lock, std::chrono::milliseconds(100));
+            continue;
+        }
+        pending_count_.fetch_sub(1, std::memory_order_relaxed);
+
+        try {
+            // One insert per block: each column goes over as a contiguous
+            // compressed run
+            clickhouse_->insert_trade_block(config_.table, *block);
+            rows_archived_.fetch_add(block->rows(), std::memory_order_relaxed);
+            blocks_flushed_.fetch_add(1, std::memory_order_relaxed);
+        } catch (const std::exception& e) {
+            blocks_dropped_.fetch_add(1, std::memory_order_relaxed);
+            spdlog::error("ClickHouse block insert failed, {} rows lost: {}",
+                          block->rows(), e.what());
+        }
+
+        block->clear();
+        free_list_.push(std::move(block));
+    }
+
+    spdlog::debug("TradeArchiver flush thread finished");
+}
+
+TradeArchiver::Stats TradeArchiver::get_stats() const {
+    Stats stats;
+    stats.rows_archived = rows_archived_.load(std::memory_order_relaxed);
+    stats.blocks_flushed = blocks_flushed_.load(std::memory_order_relaxed);
+    stats.blocks_dropped = blocks_dropped_.load(std::memory_order_relaxed);
+    stats.pending_blocks = pending_count_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace persistence
+} // namespace dharmaguard
@@ -0,0 +1,160 @@
+#include "surveillance/account_graph.hpp"
+
+#include "surveillance/trade_pattern_detector.hpp"
+
+#include <algorithm>
+
+namespace dharmaguard {
+namespace surveillance {
+
+AccountGraph::AccountGraph(size_t capacity)
+    : nodes_(capacity)
+{
+    // Every ID starts as its own cluster root
+    for (uint32_t id = 0; id < nodes_.size(); ++id) {
+        nodes_[id].parent.store(id, std::memory_order_relaxed);
+    }
+}
+
+void AccountGraph::observe_trade(const TradeRecord& trade) {
+    // The client ID acts as the cluster hub: all accounts of one client
+    // (group-account brokers) merge through it without pairwise links
+    link(trade.account_id, trade.client_id);
+
+    add_neighbor(trade.account_id, trade.instrument_id);
+    add_neighbor(trade.instrument_id, trade.account_id);
+}
+
+void AccountGraph::link(uint32_t a, uint32_t b) {
+    if (!in_range(a) || !in_range(b)) {
+        return;
+    }
+
+    // Lock-free union by smaller root ID; losers of the CAS retry with
+    // fresh roots
+    for (;;) {
+        uint32_t root_a = find(a);
+        uint32_t root_b = find(b);
+        if (root_a == root_b) {
+            return;
+        }
+        if (root_a > root_b) {
+            std::swap(root_a, root_b);
+        }
+
+        uint32_t expected = root_b;
+        if (nodes_[root_b].parent.compare_exchange_weak(
+                expected, root_a, std::memory_order_acq_rel)) {
+            nodes_[root_a].cluster_size.fetch_add(
+                nodes_[root_b].cluster_size.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+uint32_t AccountGraph::cluster_of(uint32_t id) {
+    return in_range(id) ? find(id) : id;
+}
+
+uint32_t AccountGraph::cluster_size(uint32_t id) {
+    if (!in_range(id)) {
+        return 1;
+    }
+    return nodes_[find(id)].cluster_size.load(std::memory_order_relaxed);
+}
+
+uint32_t AccountGraph::find(uint32_t id) {
+    // Path halving: point every other node at its grandparent on the way
+    // up, keeping chains short without a second pass
+    uint32_t current = id;
+    for (;;) {
+        uint32_t parent = nodes_[current].parent.load(std::memory_order_acquire);
+        if (parent == current) {
+            return current;
+        }
+        uint32_t grandparent = nodes_[parent].parent.load(std::memory_order_acquire);
+        if (parent != grandparent) {
+            nodes_[current].parent.compare_exchange_weak(
+                parent, grandparent, std::memory_order_acq_rel);
+        }
+        current = grandparent;
+    }
+}
+
+void AccountGraph::add_neighbor(uint32_t from, uint32_t to) {
+    if (!in_range(from) || !in_range(to)) {
+        return;
+    }
+
+    Node& node = nodes_[from];
+    uint32_t count = node.neighbor_count.load(std::memory_order_acquire);
+    size_t live = std::min<size_t>(count, kMaxNeighbors);
+
+    // Skip duplicates over the small live window
+    for (size_t i = 0; i < live; ++i) {
+        if (node.neighbors[i].load(std::memory_order_relaxed) == to) {
+            return;
+        }
+    }
+
+    // Ring overwrite: the slot index keeps advancing so the newest edges
+    // displace the oldest once the ring is full
+    uint32_t slot = node.neighbor_count.fetch_add(1, std::memory_order_acq_rel);
+    node.neighbors[slot % kMaxNeighbors].store(to, std::memory_order_release);
+}
+
+size_t AccountGraph::neighbors(uint32_t id,
+                               std::array<uint32_t, kMaxNeighbors>& out) const {
+    if (!in_range(id)) {
+        return 0;
+    }
+
+    const Node& node = nodes_[id];
+    size_t live = std::min<size_t>(
+        node.neighbor_count.load(std::memory_order_acquire), kMaxNeighbors);
+    for (size_t i = 0; i < live; ++i) {
+        out[i] = node.neighbors[i].load(std::memory_order_relaxed);
+    }
+    return live;
+}
+
+void AccountGraph::k_hop_neighborhood(uint32_t start, size_t hops,
+                                      std::vector<uint32_t>& out,
+                                      size_t max_nodes) {
+    out.clear();
+    if (!in_range(start) || hops == 0) {
+        return;
+    }
+
+    std::array<uint32_t, kMaxNeighbors> scratch;
+    size_t frontier_begin = 0;
+
+    // BFS over the capped rings; `out` doubles as the visited set, which
+    // stays cheap because max_nodes bounds it to a few hundred entries
+    size_t count = neighbors(start, scratch);
+    for (size_t i = 0; i < count && out.size() < max_nodes; ++i) {
+        if (scratch[i] != start) {
+            out.push_back(scratch[i]);
+        }
+    }
+
+    for (size_t hop = 1; hop < hops && out.size() < max_nodes; ++hop) {
+        size_t frontier_end = out.size();
+        for (size_t f = frontier_begin; f < frontier_end && out.size() < max_nodes; ++f) {
+            count = neighbors(out[f], scratch);
+            for (size_t i = 0; i < count && out.size() < max_nodes; ++i) {
+                uint32_t candidate = scratch[i];
+                if (candidate == start ||
+                    std::find(out.begin(), out.end(), candidate) != out.end()) {
+                    continue;
+                }
+                out.push_back(candidate);
+            }
+        }
+        frontier_begin = frontier_end;
+    }
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,204 @@
+#include "surveillance/backtest_runner.hpp"
+
+#include "capture/trade_capture.hpp"
+#include "messaging/binary_trade_codec.hpp"
+#include "surveillance/detector_profiles.hpp"
+#include "surveillance/trade_pattern_detector.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <mutex>
+
+namespace dharmaguard {
+namespace surveillance {
+
+BacktestRunner::BacktestRunner(Config config)
+    : config_(config)
+{
+}
+
+bool BacktestRunner::run(const std::string& capture_path,
+                         const std::vector<Variant>& variants) {
+    if (variants.empty()) {
+        spdlog::error("Backtest needs at least one variant");
+        return false;
+    }
+
+    results_.clear();
+    results_.reserve(variants.size());
+
+    for (const auto& variant : variants) {
+        VariantResult result;
+        spdlog::info("Backtest variant '{}' starting ({} threads)",
+                     variant.name, config_.num_threads);
+        if (!run_variant(variant, capture_path, result)) {
+            spdlog::error("Backtest variant '{}' failed", variant.name);
+            return false;
+        }
+        results_.push_back(std::move(result));
+    }
+    return true;
+}
+
+bool BacktestRunner::run_variant(const Variant& variant,
+                                 const std::string& capture_path,
+                                 VariantResult& result) {
+    capture::TradeCaptureReader reader;
+    if (!reader.open(capture_path)) {
+        return false;
+    }
+
+    result.name = variant.name;
+
+    // Fresh production stack per variant: same detector code, same
+    // sharding, no window state carried over from the previous run
+    TradePatternDetector detector(config_.num_threads, config_.queue_size);
+    if (!detector.initialize(variant.config_path)) {
+        return false;
+    }
+    if (!variant.detector_profile.empty()) {
+        if (auto profile = config_profile_from_string(variant.detector_profile)) {
+            detector.set_config_profile(*profile);
+        } else {
+            spdlog::warn("Unknown detector profile '{}' for variant '{}', "
+                         "using runtime config",
+                         variant.detector_profile, variant.name);
+        }
+    }
+
+    // Alerts are rare relative to trades, so a mutex around the key set
+    // costs nothing next to the detection work
+    std::mutex alert_mutex;
+    detector.set_alert_callback([&](const SurveillanceAlert& alert) {
+        std::lock_guard<std::mutex> lock(alert_mutex);
+        result.alert_keys.insert(alert.alert_type + "|" + alert.title);
+    });
+
+    if (!detector.start()) {
+        return false;
+    }
+
+    auto run_start = std::chrono::steady_clock::now();
+
+    std::vector<TradeRecord> batch(config_.batch_size);
+    uint64_t queued_total = 0;
+
+    for (size_t i = 0; i < reader.size();) {
+        size_t n = std::min(config_.batch_size, reader.size() - i);
+        const int64_t ingress_ns = ingress_now_ns();
+        for (size_t j = 0; j < n; ++j) {
+            messaging::BinaryTradeCodec::decode_record(reader.record(i + j),
+                                                       batch[j]);
+            batch[j].ingress_ns = ingress_ns;
+        }
+
+        // Backpressure on queue depth instead of resubmitting: the batch
+        // call skips (and counts) rejected records, so its return value
+        // is not a resumable prefix
+        while (detector.get_statistics().queue_size > config_.queue_size / 2) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        queued_total += detector.process_records_batch(batch.data(), n);
+        i += n;
+        result.trades_submitted += n;
+    }
+
+    // Let the workers finish the tail, then stop to flush the dispatcher
+    while (detector.get_statistics().queue_size > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    detector.stop();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - run_start);
+
+    auto stats = detector.get_statistics();
+    result.alerts_generated = stats.total_alerts_generated;
+    result.alerts_by_pattern = stats.pattern_alerts_count;
+    result.elapsed_seconds = elapsed.count() / 1000.0;
+    result.trades_per_second = result.elapsed_seconds > 0.0
+        ? static_cast<double>(queued_total) / result.elapsed_seconds
+        : 0.0;
+
+    if (queued_total < result.trades_submitted) {
+        spdlog::warn("Variant '{}': {} of {} records not queued "
+                     "(rejected, duplicate or dropped)",
+                     variant.name, result.trades_submitted - queued_total,
+                     result.trades_submitted);
+    }
+    return true;
+}
+
+BacktestRunner::DiffReport BacktestRunner::diff(const VariantResult& baseline,
+                                                const VariantResult& variant) {
+    DiffReport report;
+    report.baseline = baseline.name;
+    report.variant = variant.name;
+
+    for (const auto& key : baseline.alert_keys) {
+        if (variant.alert_keys.count(key)) {
+            ++report.common;
+        } else {
+            ++report.only_in_baseline;
+            if (report.sample_lost.size() < kDiffSamples) {
+                report.sample_lost.push_back(key);
+            }
+        }
+    }
+    for (const auto& key : variant.alert_keys) {
+        if (!baseline.alert_keys.count(key)) {
+            ++report.only_in_variant;
+            if (report.sample_gained.size() < kDiffSamples) {
+                report.sample_gained.push_back(key);
+            }
+        }
+    }
+
+    for (const auto& [pattern, count] : variant.alerts_by_pattern) {
+        report.pattern_delta[pattern] += static_cast<int64_t>(count);
+    }
+    for (const auto& [pattern, count] : baseline.alerts_by_pattern) {
+        report.pattern_delta[pattern] -= static_cast<int64_t>(count);
+    }
+    return report;
+}
+
+void BacktestRunner::print_report() const {
+    spdlog::info("=== Backtest Report ===");
+    for (const auto& result : results_) {
+        spdlog::info("Variant '{}': {} trades in {:.1f}s ({:.0f} trades/sec), "
+                     "{} alerts, {} distinct",
+                     result.name, result.trades_submitted,
+                     result.elapsed_seconds, result.trades_per_second,
+                     result.alerts_generated, result.alert_keys.size());
+        for (const auto& [pattern, count] : result.alerts_by_pattern) {
+            if (count > 0) {
+                spdlog::info("  {}: {} alerts", pattern, count);
+            }
+        }
+    }
+
+    for (size_t i = 1; i < results_.size(); ++i) {
+        auto report = diff(results_.front(), results_[i]);
+        spdlog::info("Diff '{}' vs baseline '{}': {} common, {} lost, {} gained",
+                     report.variant, report.baseline, report.common,
+                     report.only_in_baseline, report.only_in_variant);
+        for (const auto& [pattern, delta] : report.pattern_delta) {
+            if (delta != 0) {
+                spdlog::info("  {}: {:+} alerts", pattern, delta);
+            }
+        }
+        for (const auto& key : report.sample_lost) {
+            spdlog::info("  lost: {}", key);
+        }
+        for (const auto& key : report.sample_gained) {
+            spdlog::info("  gained: {}", key);
+        }
+    }
+    spdlog::info("=======================");
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
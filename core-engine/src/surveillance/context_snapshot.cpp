@@ -0,0 +1,211 @@
+#include "surveillance/context_snapshot.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <spdlog/spdlog.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace dharmaguard {
+namespace surveillance {
+
+namespace {
+
+// String table entries are a u16 length followed by the bytes
+size_t string_table_size(const StringInterner& interner, uint32_t string_count) {
+    size_t total = 0;
+    for (uint32_t id = 1; id <= string_count; ++id) {
+        total += sizeof(uint16_t) + interner.resolve(id).size();
+    }
+    return total;
+}
+
+} // namespace
+
+bool ContextSnapshot::write(const std::string& path,
+                            const std::vector<TradeRecord>& records,
+                            std::chrono::system_clock::time_point snapshot_time) {
+    auto& interner = StringInterner::instance();
+    uint32_t string_count = static_cast<uint32_t>(interner.size());
+
+    size_t total_size = sizeof(SnapshotFileHeader) +
+                        string_table_size(interner, string_count) +
+                        records.size() * sizeof(TradeRecord);
+
+    // Build the image in a temp file and rename it in; the previous
+    // snapshot stays valid if anything below fails
+    std::string tmp_path = path + ".tmp";
+    int fd = ::open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        spdlog::error("Failed to create snapshot temp file: {}", tmp_path);
+        return false;
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(total_size)) != 0) {
+        spdlog::error("Failed to size snapshot file to {} bytes", total_size);
+        ::close(fd);
+        ::unlink(tmp_path.c_str());
+        return false;
+    }
+
+    void* mapping = ::mmap(nullptr, total_size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        spdlog::error("Failed to mmap snapshot file: {}", tmp_path);
+        ::unlink(tmp_path.c_str());
+        return false;
+    }
+
+    SnapshotFileHeader header{};
+    header.magic = SnapshotFileHeader::kMagic;
+    header.version = SnapshotFileHeader::kVersion;
+    header.flags = 0;
+    header.record_size = sizeof(TradeRecord);
+    header.string_count = string_count;
+    header.record_count = records.size();
+    header.snapshot_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        snapshot_time.time_since_epoch()).count();
+
+    uint8_t* cursor = static_cast<uint8_t*>(mapping);
+    std::memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+
+    for (uint32_t id = 1; id <= string_count; ++id) {
+        const std::string& value = interner.resolve(id);
+        uint16_t length = static_cast<uint16_t>(value.size());
+        std::memcpy(cursor, &length, sizeof(length));
+        cursor += sizeof(length);
+        std::memcpy(cursor, value.data(), length);
+        cursor += length;
+    }
+
+    std::memcpy(cursor, records.data(), records.size() * sizeof(TradeRecord));
+
+    bool synced = ::msync(mapping, total_size, MS_SYNC) == 0;
+    ::munmap(mapping, total_size);
+
+    if (!synced || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        spdlog::error("Failed to finalize snapshot: {}", path);
+        ::unlink(tmp_path.c_str());
+        return false;
+    }
+
+    spdlog::info("Context snapshot written: {} records, {} strings, {} bytes",
+                 records.size(), string_count, total_size);
+    return true;
+}
+
+bool ContextSnapshot::load(const std::string& path,
+                           const std::function<void(const TradeRecord&)>& sink) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        spdlog::info("No context snapshot at {}, starting cold", path);
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(SnapshotFileHeader)) {
+        spdlog::error("Snapshot file too small or unreadable: {}", path);
+        ::close(fd);
+        return false;
+    }
+
+    size_t mapping_size = static_cast<size_t>(st.st_size);
+    void* mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        spdlog::error("Failed to mmap snapshot file: {}", path);
+        return false;
+    }
+
+    bool ok = false;
+    do {
+        SnapshotFileHeader header;
+        std::memcpy(&header, mapping, sizeof(header));
+
+        if (header.magic != SnapshotFileHeader::kMagic ||
+            header.version != SnapshotFileHeader::kVersion) {
+            spdlog::error("Snapshot file has bad magic/version: {}", path);
+            break;
+        }
+        if (header.record_size != sizeof(TradeRecord)) {
+            spdlog::error("Snapshot record size mismatch: file has {}, expected {}",
+                          header.record_size, sizeof(TradeRecord));
+            break;
+        }
+
+        const uint8_t* cursor = static_cast<const uint8_t*>(mapping) + sizeof(header);
+        const uint8_t* end = static_cast<const uint8_t*>(mapping) + mapping_size;
+
+        // Re-intern the string table; index i holds the current-process ID
+        // for snapshot ID i
+        auto& interner = StringInterner::instance();
+        std::vector<uint32_t> id_map(header.string_count + 1, StringInterner::kInvalidId);
+
+        bool table_ok = true;
+        for (uint32_t id = 1; id <= header.string_count; ++id) {
+            uint16_t length;
+            if (cursor + sizeof(length) > end) {
+                table_ok = false;
+                break;
+            }
+            std::memcpy(&length, cursor, sizeof(length));
+            cursor += sizeof(length);
+
+            if (cursor + length > end) {
+                table_ok = false;
+                break;
+            }
+            id_map[id] = interner.intern(
+                std::string_view(reinterpret_cast<const char*>(cursor), length));
+            cursor += length;
+        }
+        if (!table_ok) {
+            spdlog::error("Snapshot string table truncated: {}", path);
+            break;
+        }
+
+        if (cursor + header.record_count * sizeof(TradeRecord) > end) {
+            spdlog::error("Snapshot record run truncated: {}", path);
+            break;
+        }
+
+        auto remap = [&id_map](uint32_t id) {
+            return id < id_map.size() ? id_map[id] : StringInterner::kInvalidId;
+        };
+
+        for (uint64_t i = 0; i < header.record_count; ++i) {
+            TradeRecord record;
+            std::memcpy(&record, cursor, sizeof(record));
+            cursor += sizeof(record);
+
+            record.instrument_id = remap(record.instrument_id);
+            record.account_id = remap(record.account_id);
+            record.client_id = remap(record.client_id);
+            record.exchange_id = remap(record.exchange_id);
+            record.trader_id = remap(record.trader_id);
+            sink(record);
+        }
+
+        auto snapshot_age = std::chrono::system_clock::now() -
+            std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(header.snapshot_time_ns)));
+        spdlog::info("Context snapshot loaded: {} records, {} strings, taken {}s ago",
+                     header.record_count, header.string_count,
+                     std::chrono::duration_cast<std::chrono::seconds>(snapshot_age).count());
+        ok = true;
+    } while (false);
+
+    ::munmap(mapping, mapping_size);
+    return ok;
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
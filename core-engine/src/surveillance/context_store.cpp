@@ -0,0 +1,104 @@
+#include "surveillance/context_store.hpp"
+
+#include <limits>
+
+namespace dharmaguard {
+namespace surveillance {
+
+namespace {
+
+size_t round_up_pow2(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+int64_t to_epoch_ns(std::chrono::system_clock::time_point tp) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        tp.time_since_epoch()).count();
+}
+
+} // namespace
+
+ContextStore::ContextStore(size_t capacity, std::chrono::nanoseconds ttl)
+    : meta_(round_up_pow2(capacity))
+    , contexts_(meta_.size())
+    , mask_(meta_.size() - 1)
+    , ttl_ns_(ttl.count())
+{
+}
+
+HistoricalContext& ContextStore::get_or_create(
+    uint64_t key, std::chrono::system_clock::time_point now) {
+
+    // Key 0 is the empty-slot sentinel: it would "hit" any empty slot
+    // without claiming it, and a later real key claiming that slot would
+    // inherit the zero key's window. The ingest paths reject the trades
+    // that produce it (empty identifiers intern to ID 0), but remap it
+    // here too so no caller can contaminate another context
+    if (key == 0) {
+        key = std::numeric_limits<uint64_t>::max();
+    }
+
+    int64_t now_ns = to_epoch_ns(now);
+    size_t home = mix(key) & mask_;
+
+    constexpr size_t kNone = std::numeric_limits<size_t>::max();
+    size_t empty_slot = kNone;
+    size_t expired_slot = kNone;
+    size_t lru_slot = kNone;
+    int64_t lru_access = std::numeric_limits<int64_t>::max();
+
+    // Scan the whole window - inserts may land anywhere in it, so a hit
+    // can follow an empty slot
+    for (size_t probe = 0; probe < kProbeWindow; ++probe) {
+        size_t slot = (home + probe) & mask_;
+        SlotMeta& meta = meta_[slot];
+
+        if (meta.key == key) {
+            meta.last_access_ns = now_ns;
+            return contexts_[slot];
+        }
+
+        if (meta.key == 0) {
+            if (empty_slot == kNone) {
+                empty_slot = slot;
+            }
+            continue;
+        }
+
+        if (expired_slot == kNone && now_ns - meta.last_access_ns > ttl_ns_) {
+            expired_slot = slot;
+        }
+        if (meta.last_access_ns < lru_access) {
+            lru_access = meta.last_access_ns;
+            lru_slot = slot;
+        }
+    }
+
+    size_t slot;
+    if (empty_slot != kNone) {
+        slot = empty_slot;
+        ++size_;
+    } else if (expired_slot != kNone) {
+        slot = expired_slot;
+        contexts_[slot].reset();
+        ++ttl_evictions_;
+    } else {
+        // Window full of live contexts; displace the coldest. Frequent
+        // LRU evictions mean the store is undersized for the day's flow -
+        // watch the lru_evictions metric
+        slot = lru_slot;
+        contexts_[slot].reset();
+        ++lru_evictions_;
+    }
+
+    meta_[slot].key = key;
+    meta_[slot].last_access_ns = now_ns;
+    return contexts_[slot];
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,193 @@
+#include "surveillance/hot_path_logger.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace dharmaguard {
+namespace surveillance {
+
+namespace {
+
+spdlog::level::level_enum to_spdlog_level(LogSeverity severity) {
+    switch (severity) {
+        case LogSeverity::kInfo: return spdlog::level::info;
+        case LogSeverity::kWarn: return spdlog::level::warn;
+        case LogSeverity::kError: return spdlog::level::err;
+    }
+    return spdlog::level::info;
+}
+
+} // namespace
+
+HotPathLogger::HotPathLogger() {
+    static std::atomic<uint64_t> next_id{0};
+    logger_id_ = next_id.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+HotPathLogger::~HotPathLogger() {
+    if (running_.load()) {
+        stop();
+    }
+}
+
+uint32_t HotPathLogger::register_site(LogSeverity severity, std::string format,
+                                      SiteOptions options) {
+    auto site = std::make_unique<SiteState>();
+    site->severity = severity;
+    site->format = std::move(format);
+    site->options = options;
+    site->options.every_k = std::max<uint64_t>(site->options.every_k, 1);
+
+    sites_.push_back(std::move(site));
+    return static_cast<uint32_t>(sites_.size() - 1);
+}
+
+uint32_t HotPathLogger::register_site(LogSeverity severity, std::string format) {
+    return register_site(severity, std::move(format), SiteOptions{});
+}
+
+bool HotPathLogger::start() {
+    if (running_.load()) {
+        spdlog::warn("HotPathLogger is already running");
+        return false;
+    }
+
+    running_.store(true);
+    formatter_thread_ = std::thread(&HotPathLogger::formatter_thread_func, this);
+
+    spdlog::info("HotPathLogger started - {} sites, {} records per thread ring",
+                 sites_.size(), kRingCapacity);
+    return true;
+}
+
+void HotPathLogger::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    running_.store(false);
+    if (formatter_thread_.joinable()) {
+        formatter_thread_.join();
+    }
+
+    // Producers are quiescent by the time the facade stops; flush what
+    // they left behind and account for everything suppressed or dropped
+    drain_rings();
+    report_suppressed();
+
+    auto stats = get_stats();
+    spdlog::info("HotPathLogger stopped - emitted: {}, suppressed: {}, dropped: {}",
+                 stats.records_emitted, stats.records_suppressed,
+                 stats.records_dropped);
+}
+
+HotPathLogger::Stats HotPathLogger::get_stats() const {
+    Stats stats;
+    stats.records_emitted = records_emitted_.load(std::memory_order_relaxed);
+    for (const auto& site : sites_) {
+        stats.records_suppressed += site->suppressed.load(std::memory_order_relaxed);
+    }
+    for (const auto& ring : rings_) {
+        stats.records_dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+HotPathLogger::ThreadRing* HotPathLogger::ring_for_this_thread() {
+    // Per-thread ring cache keyed by the never-reused logger ID, not the
+    // facade's address: a logger constructed at a destroyed one's
+    // recycled address must not inherit a stale ring pointing into freed
+    // memory. One slot per facade this thread has logged through, so a
+    // thread moving between loggers keeps each binding instead of
+    // registering a fresh ring on every switch. The registry is only
+    // locked on a thread's first log through a facade.
+    struct TlsSlot {
+        uint64_t logger_id;
+        ThreadRing* ring;
+    };
+    static thread_local std::vector<TlsSlot> slots;
+
+    for (const TlsSlot& slot : slots) {
+        if (slot.logger_id == logger_id_) {
+            return slot.ring;
+        }
+    }
+
+    ThreadRing* ring = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings_.push_back(std::make_unique<ThreadRing>());
+        ring = rings_.back().get();
+    }
+    slots.push_back({logger_id_, ring});
+    return ring;
+}
+
+void HotPathLogger::formatter_thread_func() {
+    spdlog::debug("HotPathLogger formatter thread started");
+
+    auto last_report = std::chrono::steady_clock::now();
+
+    while (running_.load()) {
+        drain_rings();
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_report >= std::chrono::seconds(5)) {
+            report_suppressed();
+            last_report = now;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    spdlog::debug("HotPathLogger formatter thread finished");
+}
+
+void HotPathLogger::drain_rings() {
+    // Snapshot the ring set under the lock; rings are never removed, so
+    // the raw pointers stay valid while draining unlocked
+    std::vector<ThreadRing*> rings;
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings.reserve(rings_.size());
+        for (const auto& ring : rings_) {
+            rings.push_back(ring.get());
+        }
+    }
+
+    for (ThreadRing* ring : rings) {
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+
+        while (tail != head) {
+            const LogRecord& record = ring->records[tail & (kRingCapacity - 1)];
+            const SiteState& site = *sites_[record.site];
+            try {
+                spdlog::log(to_spdlog_level(site.severity),
+                            fmt::runtime(site.format),
+                            record.arg0, record.arg1, record.text);
+            } catch (const std::exception& e) {
+                spdlog::error("HotPathLogger bad format '{}': {}",
+                              site.format, e.what());
+            }
+            records_emitted_.fetch_add(1, std::memory_order_relaxed);
+            ++tail;
+        }
+
+        ring->tail.store(tail, std::memory_order_release);
+    }
+}
+
+void HotPathLogger::report_suppressed() {
+    for (auto& site : sites_) {
+        uint64_t suppressed = site->suppressed.load(std::memory_order_relaxed);
+        if (suppressed > site->reported) {
+            spdlog::log(to_spdlog_level(site->severity),
+                        "({} occurrences suppressed of: {})",
+                        suppressed - site->reported, site->format);
+            site->reported = suppressed;
+        }
+    }
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
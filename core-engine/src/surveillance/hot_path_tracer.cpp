@@ -0,0 +1,158 @@
+#include "surveillance/hot_path_tracer.hpp"
+
+#include <bit>
+#include <thread>
+
+#include <spdlog/spdlog.h>
+
+namespace dharmaguard {
+namespace surveillance {
+
+HotPathTracer::HotPathTracer(size_t num_workers, size_t sample_rate)
+    : sample_mask_(std::bit_ceil(std::max<size_t>(sample_rate, 1)) - 1)
+    , cycles_per_ns_(measure_cycles_per_ns())
+{
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers_.push_back(std::make_unique<WorkerState>());
+    }
+
+    spdlog::info("Hot-path tracer: 1/{} sampling, {:.2f} cycles/ns",
+                 sample_mask_ + 1, cycles_per_ns_);
+}
+
+void HotPathTracer::register_detector(const std::string& name) {
+    if (detector_names_.size() >= kMaxDetectorSlots) {
+        spdlog::warn("Tracer detector slots exhausted, {} aggregates into 'other'",
+                     name);
+        return;
+    }
+    for (const auto& existing : detector_names_) {
+        if (existing == name) {
+            return;
+        }
+    }
+    detector_names_.push_back(name);
+    budgets_ns_.push_back(0);
+
+    std::lock_guard<std::mutex> lock(agg_mutex_);
+    detector_aggs_.resize(detector_names_.size() + 1);
+}
+
+void HotPathTracer::set_budget(const std::string& name, uint64_t budget_ns) {
+    for (size_t i = 0; i < detector_names_.size(); ++i) {
+        if (detector_names_[i] == name) {
+            budgets_ns_[i] = budget_ns;
+            spdlog::info("Pattern {} time budget: {} ns/trade", name, budget_ns);
+            return;
+        }
+    }
+    spdlog::warn("Cannot set budget, detector not registered with tracer: {}", name);
+}
+
+void HotPathTracer::drain() {
+    std::lock_guard<std::mutex> lock(agg_mutex_);
+    if (detector_aggs_.empty()) {
+        detector_aggs_.resize(detector_names_.size() + 1);
+    }
+
+    for (auto& worker : workers_) {
+        uint64_t tail = worker->tail.load(std::memory_order_relaxed);
+        uint64_t head = worker->head.load(std::memory_order_acquire);
+
+        for (; tail != head; ++tail) {
+            const TraceSample& sample = worker->ring[tail & (kRingCapacity - 1)];
+            uint64_t ns = static_cast<uint64_t>(
+                static_cast<double>(sample.cycles) / cycles_per_ns_);
+
+            StageTiming& stage = stage_aggs_[sample.stage];
+            stage.samples += 1;
+            stage.total_ns += ns;
+            stage.max_ns = std::max(stage.max_ns, ns);
+
+            if (sample.stage == static_cast<uint8_t>(TraceStage::kDetector) &&
+                sample.slot < detector_aggs_.size()) {
+                DetectorAgg& agg = detector_aggs_[sample.slot];
+                agg.samples += 1;
+                agg.total_ns += ns;
+                agg.max_ns = std::max(agg.max_ns, ns);
+
+                if (sample.slot > 0) {
+                    uint64_t budget = budgets_ns_[sample.slot - 1];
+                    if (budget > 0 && ns > budget) {
+                        agg.budget_violations += 1;
+                        agg.violations_since_take += 1;
+                    }
+                }
+            }
+        }
+
+        worker->tail.store(tail, std::memory_order_release);
+    }
+}
+
+HotPathTracer::Report HotPathTracer::report() const {
+    std::lock_guard<std::mutex> lock(agg_mutex_);
+
+    Report report;
+    report.stages = stage_aggs_;
+    report.sample_rate = sample_mask_ + 1;
+
+    for (const auto& worker : workers_) {
+        report.dropped_samples += worker->dropped.load(std::memory_order_relaxed);
+    }
+
+    for (size_t slot = 1; slot < detector_aggs_.size(); ++slot) {
+        const DetectorAgg& agg = detector_aggs_[slot];
+        if (agg.samples == 0) {
+            continue;
+        }
+        DetectorTiming timing;
+        timing.name = detector_names_[slot - 1];
+        timing.samples = agg.samples;
+        timing.total_ns = agg.total_ns;
+        timing.max_ns = agg.max_ns;
+        timing.budget_violations = agg.budget_violations;
+        report.detectors.push_back(std::move(timing));
+    }
+
+    return report;
+}
+
+std::vector<std::pair<std::string, uint64_t>> HotPathTracer::take_budget_violations() {
+    std::lock_guard<std::mutex> lock(agg_mutex_);
+
+    std::vector<std::pair<std::string, uint64_t>> violations;
+    for (size_t slot = 1; slot < detector_aggs_.size(); ++slot) {
+        DetectorAgg& agg = detector_aggs_[slot];
+        if (agg.violations_since_take > 0) {
+            violations.emplace_back(detector_names_[slot - 1],
+                                    agg.violations_since_take);
+            agg.violations_since_take = 0;
+        }
+    }
+    return violations;
+}
+
+double HotPathTracer::measure_cycles_per_ns() {
+#if defined(__x86_64__) || defined(__i386__)
+    // One-shot calibration against the steady clock; 20ms is plenty for
+    // three significant digits and only runs at configure time
+    auto wall_start = std::chrono::steady_clock::now();
+    uint64_t tsc_start = read_tsc();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    uint64_t tsc_end = read_tsc();
+    auto wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - wall_start).count();
+
+    double ratio = static_cast<double>(tsc_end - tsc_start) /
+                   static_cast<double>(wall_ns);
+    return ratio > 0.0 ? ratio : 1.0;
+#else
+    // read_tsc() already returns nanoseconds on non-x86 targets
+    return 1.0;
+#endif
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,213 @@
+#include "surveillance/simd/batch_validator.hpp"
+
+#include <chrono>
+#include <limits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace dharmaguard {
+namespace surveillance {
+namespace simd {
+
+void ValidationColumns::assign(const TradeRecord* records, size_t count) {
+    prices.resize(count);
+    quantities.resize(count);
+    timestamps_ns.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const TradeRecord& record = records[i];
+        prices[i] = record.price;
+        quantities[i] = static_cast<double>(record.quantity);
+        timestamps_ns[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            record.timestamp.time_since_epoch()).count();
+    }
+}
+
+namespace {
+
+// Collapse the optional timestamp window into an always-checked
+// [lower, upper] pair so the kernels have no per-element branches
+struct TimestampBounds {
+    int64_t lower;
+    int64_t upper;
+};
+
+TimestampBounds timestamp_bounds(const ValidationLimits& limits, int64_t now_ns) {
+    TimestampBounds bounds;
+    bounds.lower = limits.max_age_ns > 0 ? now_ns - limits.max_age_ns : 1;
+    bounds.upper = limits.max_future_skew_ns > 0
+        ? now_ns + limits.max_future_skew_ns
+        : std::numeric_limits<int64_t>::max();
+    return bounds;
+}
+
+// ---------------------------------------------------------------------------
+// Scalar reference kernel - always available, also used for vector tails
+// ---------------------------------------------------------------------------
+
+size_t validate_scalar(const double* prices, const double* quantities,
+                       const int64_t* timestamps, size_t count,
+                       const ValidationLimits& limits, TimestampBounds bounds,
+                       uint8_t* valid) {
+    size_t valid_count = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t ok = static_cast<uint8_t>(prices[i] > limits.min_price) &
+                     static_cast<uint8_t>(prices[i] < limits.max_price) &
+                     static_cast<uint8_t>(quantities[i] >= limits.min_quantity) &
+                     static_cast<uint8_t>(quantities[i] <= limits.max_quantity) &
+                     static_cast<uint8_t>(timestamps[i] >= bounds.lower) &
+                     static_cast<uint8_t>(timestamps[i] <= bounds.upper);
+        valid[i] = ok;
+        valid_count += ok;
+    }
+    return valid_count;
+}
+
+#if defined(__x86_64__)
+
+// ---------------------------------------------------------------------------
+// AVX2 kernel (4 elements per lane group)
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx2")))
+size_t validate_avx2(const double* prices, const double* quantities,
+                     const int64_t* timestamps, size_t count,
+                     const ValidationLimits& limits, TimestampBounds bounds,
+                     uint8_t* valid) {
+    __m256d v_min_price = _mm256_set1_pd(limits.min_price);
+    __m256d v_max_price = _mm256_set1_pd(limits.max_price);
+    __m256d v_min_quantity = _mm256_set1_pd(limits.min_quantity);
+    __m256d v_max_quantity = _mm256_set1_pd(limits.max_quantity);
+    __m256i v_ts_lower = _mm256_set1_epi64x(bounds.lower);
+    __m256i v_ts_upper = _mm256_set1_epi64x(bounds.upper);
+
+    size_t valid_count = 0;
+    size_t vec_end = count & ~size_t(3);
+    for (size_t i = 0; i < vec_end; i += 4) {
+        __m256d price = _mm256_loadu_pd(prices + i);
+        __m256d quantity = _mm256_loadu_pd(quantities + i);
+        __m256i timestamp = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(timestamps + i));
+
+        __m256d price_ok = _mm256_and_pd(
+            _mm256_cmp_pd(price, v_min_price, _CMP_GT_OQ),
+            _mm256_cmp_pd(price, v_max_price, _CMP_LT_OQ));
+        __m256d quantity_ok = _mm256_and_pd(
+            _mm256_cmp_pd(quantity, v_min_quantity, _CMP_GE_OQ),
+            _mm256_cmp_pd(quantity, v_max_quantity, _CMP_LE_OQ));
+
+        // ts >= lower && ts <= upper, expressed through the only 64-bit
+        // integer compare AVX2 has (signed greater-than)
+        __m256i ts_bad = _mm256_or_si256(
+            _mm256_cmpgt_epi64(v_ts_lower, timestamp),
+            _mm256_cmpgt_epi64(timestamp, v_ts_upper));
+
+        int mask = _mm256_movemask_pd(_mm256_and_pd(price_ok, quantity_ok)) &
+                   ~_mm256_movemask_pd(_mm256_castsi256_pd(ts_bad));
+
+        for (size_t lane = 0; lane < 4; ++lane) {
+            uint8_t ok = static_cast<uint8_t>((mask >> lane) & 1);
+            valid[i + lane] = ok;
+            valid_count += ok;
+        }
+    }
+
+    valid_count += validate_scalar(prices + vec_end, quantities + vec_end,
+                                   timestamps + vec_end, count - vec_end,
+                                   limits, bounds, valid + vec_end);
+    return valid_count;
+}
+
+// ---------------------------------------------------------------------------
+// AVX-512 kernel (8 elements per lane group)
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx512f")))
+size_t validate_avx512(const double* prices, const double* quantities,
+                       const int64_t* timestamps, size_t count,
+                       const ValidationLimits& limits, TimestampBounds bounds,
+                       uint8_t* valid) {
+    __m512d v_min_price = _mm512_set1_pd(limits.min_price);
+    __m512d v_max_price = _mm512_set1_pd(limits.max_price);
+    __m512d v_min_quantity = _mm512_set1_pd(limits.min_quantity);
+    __m512d v_max_quantity = _mm512_set1_pd(limits.max_quantity);
+    __m512i v_ts_lower = _mm512_set1_epi64(bounds.lower);
+    __m512i v_ts_upper = _mm512_set1_epi64(bounds.upper);
+
+    size_t valid_count = 0;
+    size_t vec_end = count & ~size_t(7);
+    for (size_t i = 0; i < vec_end; i += 8) {
+        __m512d price = _mm512_loadu_pd(prices + i);
+        __m512d quantity = _mm512_loadu_pd(quantities + i);
+        __m512i timestamp = _mm512_loadu_si512(timestamps + i);
+
+        __mmask8 mask = _mm512_cmp_pd_mask(price, v_min_price, _CMP_GT_OQ);
+        mask &= _mm512_cmp_pd_mask(price, v_max_price, _CMP_LT_OQ);
+        mask &= _mm512_cmp_pd_mask(quantity, v_min_quantity, _CMP_GE_OQ);
+        mask &= _mm512_cmp_pd_mask(quantity, v_max_quantity, _CMP_LE_OQ);
+        mask &= _mm512_cmp_epi64_mask(timestamp, v_ts_lower, _MM_CMPINT_NLT);
+        mask &= _mm512_cmp_epi64_mask(timestamp, v_ts_upper, _MM_CMPINT_LE);
+
+        for (size_t lane = 0; lane < 8; ++lane) {
+            uint8_t ok = static_cast<uint8_t>((mask >> lane) & 1);
+            valid[i + lane] = ok;
+            valid_count += ok;
+        }
+    }
+
+    valid_count += validate_scalar(prices + vec_end, quantities + vec_end,
+                                   timestamps + vec_end, count - vec_end,
+                                   limits, bounds, valid + vec_end);
+    return valid_count;
+}
+
+#endif // __x86_64__
+
+// ---------------------------------------------------------------------------
+// Runtime dispatch - resolved once at process start
+// ---------------------------------------------------------------------------
+
+struct KernelTable {
+    size_t (*validate)(const double*, const double*, const int64_t*, size_t,
+                       const ValidationLimits&, TimestampBounds, uint8_t*) =
+        validate_scalar;
+    const char* name = "scalar";
+};
+
+KernelTable select_kernels() {
+    KernelTable table;
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx512f")) {
+        table.validate = validate_avx512;
+        table.name = "avx512";
+    } else if (__builtin_cpu_supports("avx2")) {
+        table.validate = validate_avx2;
+        table.name = "avx2";
+    }
+#endif
+    return table;
+}
+
+const KernelTable& kernels() {
+    static const KernelTable table = select_kernels();
+    return table;
+}
+
+} // namespace
+
+size_t validate_batch(const ValidationColumns& columns, const ValidationLimits& limits,
+                      int64_t now_ns, uint8_t* valid) {
+    return kernels().validate(columns.prices.data(), columns.quantities.data(),
+                              columns.timestamps_ns.data(), columns.size(),
+                              limits, timestamp_bounds(limits, now_ns), valid);
+}
+
+const char* validator_kernel_name() {
+    return kernels().name;
+}
+
+} // namespace simd
+} // namespace surveillance
+} // namespace dharmaguard
@@ -0,0 +1,335 @@
+#include "surveillance/simd/window_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace dharmaguard {
+namespace surveillance {
+namespace simd {
+
+void WindowSnapshot::assign(const RingBuffer<TradeRecord>& window) {
+    size_t count = window.size();
+    prices.resize(count);
+    quantities.resize(count);
+    timestamps_ns.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const TradeRecord& trade = window[i];
+        prices[i] = trade.price;
+        quantities[i] = static_cast<double>(trade.quantity);
+        timestamps_ns[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            trade.timestamp.time_since_epoch()).count();
+    }
+}
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Scalar reference kernels - always available, also used for vector tails
+// ---------------------------------------------------------------------------
+
+WindowStats stats_scalar(const double* prices, const double* quantities, size_t count) {
+    WindowStats stats;
+    if (count == 0) {
+        return stats;
+    }
+
+    double min = prices[0];
+    double max = prices[0];
+    double sum = 0.0;
+    double sq_sum = 0.0;
+    double value_sum = 0.0;
+    double quantity_sum = 0.0;
+
+    for (size_t i = 0; i < count; ++i) {
+        double price = prices[i];
+        min = std::min(min, price);
+        max = std::max(max, price);
+        sum += price;
+        sq_sum += price * price;
+        value_sum += price * quantities[i];
+        quantity_sum += quantities[i];
+    }
+
+    stats.min = min;
+    stats.max = max;
+    stats.mean = sum / static_cast<double>(count);
+    double variance = sq_sum / static_cast<double>(count) - stats.mean * stats.mean;
+    stats.stddev = variance > 0.0 ? std::sqrt(variance) : 0.0;
+    stats.vwap = quantity_sum > 0.0 ? value_sum / quantity_sum : 0.0;
+    return stats;
+}
+
+size_t count_above_scalar(const double* values, size_t count, double threshold) {
+    size_t crossings = 0;
+    for (size_t i = 0; i < count; ++i) {
+        crossings += values[i] > threshold ? 1 : 0;
+    }
+    return crossings;
+}
+
+size_t count_below_scalar(const double* values, size_t count, double threshold) {
+    size_t crossings = 0;
+    for (size_t i = 0; i < count; ++i) {
+        crossings += values[i] < threshold ? 1 : 0;
+    }
+    return crossings;
+}
+
+#if defined(__x86_64__)
+
+// ---------------------------------------------------------------------------
+// AVX2 kernels (4 doubles per lane group)
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx2,fma")))
+WindowStats stats_avx2(const double* prices, const double* quantities, size_t count) {
+    if (count < 8) {
+        return stats_scalar(prices, quantities, count);
+    }
+
+    __m256d v_min = _mm256_loadu_pd(prices);
+    __m256d v_max = v_min;
+    __m256d v_sum = _mm256_setzero_pd();
+    __m256d v_sq_sum = _mm256_setzero_pd();
+    __m256d v_value_sum = _mm256_setzero_pd();
+    __m256d v_quantity_sum = _mm256_setzero_pd();
+
+    size_t vec_end = count & ~size_t(3);
+    for (size_t i = 0; i < vec_end; i += 4) {
+        __m256d price = _mm256_loadu_pd(prices + i);
+        __m256d quantity = _mm256_loadu_pd(quantities + i);
+
+        v_min = _mm256_min_pd(v_min, price);
+        v_max = _mm256_max_pd(v_max, price);
+        v_sum = _mm256_add_pd(v_sum, price);
+        v_sq_sum = _mm256_fmadd_pd(price, price, v_sq_sum);
+        v_value_sum = _mm256_fmadd_pd(price, quantity, v_value_sum);
+        v_quantity_sum = _mm256_add_pd(v_quantity_sum, quantity);
+    }
+
+    alignas(32) double lanes[4];
+
+    auto reduce_add = [&lanes](__m256d v) {
+        _mm256_store_pd(lanes, v);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    };
+
+    _mm256_store_pd(lanes, v_min);
+    double min = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+    _mm256_store_pd(lanes, v_max);
+    double max = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+
+    double sum = reduce_add(v_sum);
+    double sq_sum = reduce_add(v_sq_sum);
+    double value_sum = reduce_add(v_value_sum);
+    double quantity_sum = reduce_add(v_quantity_sum);
+
+    // Scalar tail
+    for (size_t i = vec_end; i < count; ++i) {
+        double price = prices[i];
+        min = std::min(min, price);
+        max = std::max(max, price);
+        sum += price;
+        sq_sum += price * price;
+        value_sum += price * quantities[i];
+        quantity_sum += quantities[i];
+    }
+
+    WindowStats stats;
+    stats.min = min;
+    stats.max = max;
+    stats.mean = sum / static_cast<double>(count);
+    double variance = sq_sum / static_cast<double>(count) - stats.mean * stats.mean;
+    stats.stddev = variance > 0.0 ? std::sqrt(variance) : 0.0;
+    stats.vwap = quantity_sum > 0.0 ? value_sum / quantity_sum : 0.0;
+    return stats;
+}
+
+__attribute__((target("avx2,fma")))
+size_t count_above_avx2(const double* values, size_t count, double threshold) {
+    __m256d v_threshold = _mm256_set1_pd(threshold);
+    size_t crossings = 0;
+
+    size_t vec_end = count & ~size_t(3);
+    for (size_t i = 0; i < vec_end; i += 4) {
+        __m256d v = _mm256_loadu_pd(values + i);
+        __m256d mask = _mm256_cmp_pd(v, v_threshold, _CMP_GT_OQ);
+        crossings += static_cast<size_t>(__builtin_popcount(_mm256_movemask_pd(mask)));
+    }
+    for (size_t i = vec_end; i < count; ++i) {
+        crossings += values[i] > threshold ? 1 : 0;
+    }
+    return crossings;
+}
+
+__attribute__((target("avx2,fma")))
+size_t count_below_avx2(const double* values, size_t count, double threshold) {
+    __m256d v_threshold = _mm256_set1_pd(threshold);
+    size_t crossings = 0;
+
+    size_t vec_end = count & ~size_t(3);
+    for (size_t i = 0; i < vec_end; i += 4) {
+        __m256d v = _mm256_loadu_pd(values + i);
+        __m256d mask = _mm256_cmp_pd(v, v_threshold, _CMP_LT_OQ);
+        crossings += static_cast<size_t>(__builtin_popcount(_mm256_movemask_pd(mask)));
+    }
+    for (size_t i = vec_end; i < count; ++i) {
+        crossings += values[i] < threshold ? 1 : 0;
+    }
+    return crossings;
+}
+
+// ---------------------------------------------------------------------------
+// AVX-512 kernels (8 doubles per lane group)
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx512f")))
+WindowStats stats_avx512(const double* prices, const double* quantities, size_t count) {
+    if (count < 16) {
+        return stats_scalar(prices, quantities, count);
+    }
+
+    __m512d v_min = _mm512_loadu_pd(prices);
+    __m512d v_max = v_min;
+    __m512d v_sum = _mm512_setzero_pd();
+    __m512d v_sq_sum = _mm512_setzero_pd();
+    __m512d v_value_sum = _mm512_setzero_pd();
+    __m512d v_quantity_sum = _mm512_setzero_pd();
+
+    size_t vec_end = count & ~size_t(7);
+    for (size_t i = 0; i < vec_end; i += 8) {
+        __m512d price = _mm512_loadu_pd(prices + i);
+        __m512d quantity = _mm512_loadu_pd(quantities + i);
+
+        v_min = _mm512_min_pd(v_min, price);
+        v_max = _mm512_max_pd(v_max, price);
+        v_sum = _mm512_add_pd(v_sum, price);
+        v_sq_sum = _mm512_fmadd_pd(price, price, v_sq_sum);
+        v_value_sum = _mm512_fmadd_pd(price, quantity, v_value_sum);
+        v_quantity_sum = _mm512_add_pd(v_quantity_sum, quantity);
+    }
+
+    double min = _mm512_reduce_min_pd(v_min);
+    double max = _mm512_reduce_max_pd(v_max);
+    double sum = _mm512_reduce_add_pd(v_sum);
+    double sq_sum = _mm512_reduce_add_pd(v_sq_sum);
+    double value_sum = _mm512_reduce_add_pd(v_value_sum);
+    double quantity_sum = _mm512_reduce_add_pd(v_quantity_sum);
+
+    for (size_t i = vec_end; i < count; ++i) {
+        double price = prices[i];
+        min = std::min(min, price);
+        max = std::max(max, price);
+        sum += price;
+        sq_sum += price * price;
+        value_sum += price * quantities[i];
+        quantity_sum += quantities[i];
+    }
+
+    WindowStats stats;
+    stats.min = min;
+    stats.max = max;
+    stats.mean = sum / static_cast<double>(count);
+    double variance = sq_sum / static_cast<double>(count) - stats.mean * stats.mean;
+    stats.stddev = variance > 0.0 ? std::sqrt(variance) : 0.0;
+    stats.vwap = quantity_sum > 0.0 ? value_sum / quantity_sum : 0.0;
+    return stats;
+}
+
+__attribute__((target("avx512f")))
+size_t count_above_avx512(const double* values, size_t count, double threshold) {
+    __m512d v_threshold = _mm512_set1_pd(threshold);
+    size_t crossings = 0;
+
+    size_t vec_end = count & ~size_t(7);
+    for (size_t i = 0; i < vec_end; i += 8) {
+        __m512d v = _mm512_loadu_pd(values + i);
+        __mmask8 mask = _mm512_cmp_pd_mask(v, v_threshold, _CMP_GT_OQ);
+        crossings += static_cast<size_t>(__builtin_popcount(mask));
+    }
+    for (size_t i = vec_end; i < count; ++i) {
+        crossings += values[i] > threshold ? 1 : 0;
+    }
+    return crossings;
+}
+
+__attribute__((target("avx512f")))
+size_t count_below_avx512(const double* values, size_t count, double threshold) {
+    __m512d v_threshold = _mm512_set1_pd(threshold);
+    size_t crossings = 0;
+
+    size_t vec_end = count & ~size_t(7);
+    for (size_t i = 0; i < vec_end; i += 8) {
+        __m512d v = _mm512_loadu_pd(values + i);
+        __mmask8 mask = _mm512_cmp_pd_mask(v, v_threshold, _CMP_LT_OQ);
+        crossings += static_cast<size_t>(__builtin_popcount(mask));
+    }
+    for (size_t i = vec_end; i < count; ++i) {
+        crossings += values[i] < threshold ? 1 : 0;
+    }
+    return crossings;
+}
+
+#endif // __x86_64__
+
+// ---------------------------------------------------------------------------
+// Runtime dispatch - resolved once at process start
+// ---------------------------------------------------------------------------
+
+struct KernelTable {
+    WindowStats (*stats)(const double*, const double*, size_t) = stats_scalar;
+    size_t (*above)(const double*, size_t, double) = count_above_scalar;
+    size_t (*below)(const double*, size_t, double) = count_below_scalar;
+    const char* name = "scalar";
+};
+
+KernelTable select_kernels() {
+    KernelTable table;
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx512f")) {
+        table.stats = stats_avx512;
+        table.above = count_above_avx512;
+        table.below = count_below_avx512;
+        table.name = "avx512";
+    } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        table.stats = stats_avx2;
+        table.above = count_above_avx2;
+        table.below = count_below_avx2;
+        table.name = "avx2";
+    }
+#endif
+    return table;
+}
+
+const KernelTable& kernels() {
+    static const KernelTable table = select_kernels();
+    return table;
+}
+
+} // namespace
+
+WindowStats compute_window_stats(const double* prices, const double* quantities,
+                                 size_t count) {
+    return kernels().stats(prices, quantities, count);
+}
+
+size_t count_above(const double* values, size_t count, double threshold) {
+    return kernels().above(values, count, threshold);
+}
+
+size_t count_below(const double* values, size_t count, double threshold) {
+    return kernels().below(values, count, threshold);
+}
+
+const char* active_kernel_name() {
+    return kernels().name;
+}
+
+} // namespace simd
+} // namespace surveillance
+} // namespace dharmaguard
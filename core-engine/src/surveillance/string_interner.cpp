@@ -0,0 +1,66 @@
+#include "surveillance/string_interner.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace dharmaguard {
+namespace surveillance {
+
+const std::string StringInterner::empty_string_;
+
+StringInterner& StringInterner::instance() {
+    static StringInterner interner;
+    return interner;
+}
+
+StringInterner::StringInterner() {
+    // Reserve the full reverse table up front so resolve() can index it
+    // concurrently with interning without ever observing a reallocation
+    strings_.resize(kMaxEntries, nullptr);
+}
+
+uint32_t StringInterner::intern(std::string_view value) {
+    if (value.empty()) {
+        return kInvalidId;
+    }
+
+    // Fast path: already interned
+    std::string key(value);
+    auto it = ids_.find(key);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+
+    std::lock_guard<std::mutex> lock(append_mutex_);
+
+    // Re-check under the lock; another thread may have won the race
+    it = ids_.find(key);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+
+    uint32_t id = next_id_.load(std::memory_order_relaxed);
+    if (id > kMaxEntries) {
+        spdlog::error("String interner capacity exhausted ({} entries)", kMaxEntries);
+        return kInvalidId;
+    }
+
+    auto [inserted_it, inserted] = ids_.emplace(std::move(key), id);
+    strings_[id - 1] = &inserted_it->first;
+    next_id_.store(id + 1, std::memory_order_release);
+
+    return id;
+}
+
+const std::string& StringInterner::resolve(uint32_t id) const {
+    if (id == kInvalidId || id >= next_id_.load(std::memory_order_acquire)) {
+        return empty_string_;
+    }
+    return *strings_[id - 1];
+}
+
+size_t StringInterner::size() const {
+    return next_id_.load(std::memory_order_acquire) - 1;
+}
+
+} // namespace surveillance
+} // namespace dharmaguard
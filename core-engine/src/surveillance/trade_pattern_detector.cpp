@@ -1,9 +1,13 @@
 #include "surveillance/trade_pattern_detector.hpp"
-#include "surveillance/pump_dump_detector.hpp"
-#include "surveillance/layering_detector.hpp"
-#include "surveillance/wash_trading_detector.hpp"
-#include "surveillance/insider_trading_detector.hpp"
-#include "surveillance/front_running_detector.hpp"
+#include "surveillance/account_graph.hpp"
+#include "surveillance/context_snapshot.hpp"
+#include "surveillance/context_store.hpp"
+#include "surveillance/hot_path_logger.hpp"
+#include "surveillance/hot_path_tracer.hpp"
+#include "surveillance/simd/batch_validator.hpp"
+#include "surveillance/trade_deduper.hpp"
+#include "surveillance/wait_strategy.hpp"
+#include "surveillance/detector_pipeline.hpp"
 #include "utils/logger.hpp"
 #include "utils/config_manager.hpp"
 #include "utils/metrics_collector.hpp"
@@ -12,14 +16,149 @@
 #include <spdlog/spdlog.h>
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 
+#include <pthread.h>
+#include <sched.h>
+
+#include <array>
 #include <fstream>
 #include <algorithm>
+#include <cstring>
 #include <execution>
 
 namespace dharmaguard {
 namespace surveillance {
 
+namespace {
+
+// Copy a per-trade unique identifier into an inline record field,
+// truncating silently at the fixed capacity
+void copy_inline_id(char (&dest)[TradeRecord::kInlineIdCapacity], const std::string& src) {
+    size_t length = std::min(src.size(), TradeRecord::kInlineIdCapacity - 1);
+    std::memcpy(dest, src.data(), length);
+    dest[length] = '\0';
+}
+
+} // namespace
+
+void make_trade_record(const TradeData& trade, TradeRecord& record) {
+    auto& interner = StringInterner::instance();
+
+    copy_inline_id(record.trade_id, trade.trade_id);
+    copy_inline_id(record.order_id, trade.order_id);
+
+    record.instrument_id = interner.intern(trade.instrument_symbol);
+    record.account_id = interner.intern(trade.account_id);
+    record.client_id = interner.intern(trade.client_id);
+    record.exchange_id = interner.intern(trade.exchange);
+    record.trader_id = interner.intern(trade.trader_id);
+
+    record.trade_type = trade.trade_type;
+    record.segment = trade.segment;
+    record.quantity = trade.quantity;
+    record.price = trade.price;
+    record.value = trade.value;
+    record.timestamp = trade.timestamp;
+    record.is_own_account = trade.is_own_account;
+    record.brokerage = trade.brokerage;
+    record.taxes = trade.taxes;
+
+    // Sources that stamped at receive keep their stamp; anything else is
+    // stamped here, the last common point before the shard queues
+    record.ingress_ns = trade.ingress_ns != 0 ? trade.ingress_ns
+                                              : ingress_now_ns();
+}
+
+TradeData to_trade_data(const TradeRecord& record) {
+    auto& interner = StringInterner::instance();
+
+    TradeData trade;
+    trade.trade_id = record.trade_id;
+    trade.order_id = record.order_id;
+    trade.instrument_symbol = interner.resolve(record.instrument_id);
+    trade.account_id = interner.resolve(record.account_id);
+    trade.client_id = interner.resolve(record.client_id);
+    trade.exchange = interner.resolve(record.exchange_id);
+    trade.trader_id = interner.resolve(record.trader_id);
+
+    trade.trade_type = record.trade_type;
+    trade.segment = record.segment;
+    trade.quantity = record.quantity;
+    trade.price = record.price;
+    trade.value = record.value;
+    trade.timestamp = record.timestamp;
+    trade.is_own_account = record.is_own_account;
+    trade.brokerage = record.brokerage;
+    trade.taxes = record.taxes;
+    trade.ingress_ns = record.ingress_ns;
+
+    trade.instrument_id_hash = record.instrument_id;
+    trade.account_id_hash = record.account_id;
+    trade.client_id_hash = record.client_id;
+
+    return trade;
+}
+
+void HistoricalContext::add_trade(const TradeRecord& trade) {
+    auto cutoff_time = trade.timestamp - lookback_window;
+
+    // Expire aged entries from the front, keeping the aggregates in sync
+    while (!recent_trades.empty() && recent_trades.front().timestamp < cutoff_time) {
+        const TradeRecord& expired = recent_trades.front();
+        instrument_stats_.remove(expired.price, static_cast<double>(expired.quantity));
+        recent_trades.pop_front();
+    }
+
+    // A full ring evicts its oldest entry; liquid instruments that fill
+    // the capacity before the time window elapses degrade gracefully to a
+    // count-bounded window
+    if (recent_trades.full()) {
+        const TradeRecord& evicted = recent_trades.front();
+        instrument_stats_.remove(evicted.price, static_cast<double>(evicted.quantity));
+        recent_trades.pop_front();
+    }
+
+    recent_trades.push_back(trade);
+    instrument_stats_.add(trade.price, static_cast<double>(trade.quantity));
+
+    avg_price = instrument_stats_.avg_price();
+    avg_volume = instrument_stats_.avg_volume();
+    price_volatility = instrument_stats_.price_volatility();
+
+    // Account-scoped window and running volume
+    while (!account_recent_trades.empty() &&
+           account_recent_trades.front().timestamp < cutoff_time) {
+        account_total_volume -= account_recent_trades.front().value;
+        account_recent_trades.pop_front();
+    }
+    if (account_recent_trades.full()) {
+        account_total_volume -= account_recent_trades.front().value;
+        account_recent_trades.pop_front();
+    }
+    account_recent_trades.push_back(trade);
+    account_total_volume += trade.value;
+}
+
+void HistoricalContext::reset() {
+    recent_trades.clear();
+    account_recent_trades.clear();
+    instrument_stats_ = RollingStats{};
+
+    avg_volume = 0.0;
+    avg_price = 0.0;
+    price_volatility = 0.0;
+    bid_price = 0.0;
+    ask_price = 0.0;
+    bid_quantity = 0;
+    ask_quantity = 0;
+    account_total_volume = 0.0;
+    related_accounts.clear();
+    related_instruments.clear();
+    account_graph = nullptr;
+}
+
 /**
  * @brief Internal implementation class using PIMPL pattern
  */
@@ -27,52 +166,180 @@ class TradeProcessorImpl {
 public:
     explicit TradeProcessorImpl(size_t num_threads)
         : num_threads_(num_threads)
-        , memory_pool_(std::make_unique<MemoryPool>(1000000)) // 1M trades buffer
         , metrics_collector_(std::make_unique<MetricsCollector>())
     {
-        // Initialize performance counters
-        reset_statistics();
-    }
+        build_wait_strategies();
+
+        // 1M-trade central arena plus a per-thread-scaled heap overflow
+        // tier so burst load degrades to slower allocation, not drops.
+        // One pool until a NUMA topology is set; then one per node.
+        memory_pools_.emplace_back(std::make_unique<MemoryPool<TradeRecord>>(
+            1000000, num_threads * 65536));
 
-    void reset_statistics() {
-        trades_processed_.store(0);
-        alerts_generated_.store(0);
-        total_processing_time_ns_.store(0);
-        peak_processing_time_ns_.store(0);
+        // Hot-path log sites: binary records into per-thread rings,
+        // formatted off-path, rate limited at the source so a drop storm
+        // cannot become its own bottleneck
+        site_invalid_trade_ = hot_logger_.register_site(
+            LogSeverity::kWarn, "Invalid trade data received: {2}");
+        site_future_timestamp_ = hot_logger_.register_site(
+            LogSeverity::kWarn, "Trade timestamp is in the future: {2}");
+        site_bad_values_ = hot_logger_.register_site(
+            LogSeverity::kWarn, "Invalid price or quantity: {2}");
+        site_pool_exhausted_ = hot_logger_.register_site(
+            LogSeverity::kError,
+            "Memory pool and overflow tier exhausted, dropping trade: {2}");
+        site_queue_full_ = hot_logger_.register_site(
+            LogSeverity::kWarn, "Trade queue full on shard {0}, dropping trade: {2}");
+        site_alert_ = hot_logger_.register_site(
+            LogSeverity::kInfo,
+            "Alert generated by {2} (instrument #{0}, account #{1})",
+            HotPathLogger::SiteOptions{1000, 100});
     }
 
-    std::atomic<uint64_t> trades_processed_{0};
-    std::atomic<uint64_t> alerts_generated_{0};
-    std::atomic<uint64_t> total_processing_time_ns_{0};
-    std::atomic<uint64_t> peak_processing_time_ns_{0};
-    
     size_t num_threads_;
-    std::unique_ptr<MemoryPool> memory_pool_;
+    std::vector<std::unique_ptr<MemoryPool<TradeRecord>>> memory_pools_;
     std::unique_ptr<MetricsCollector> metrics_collector_;
-    
-    // Cache for frequently accessed data
-    tbb::concurrent_unordered_map<std::string, HistoricalContext> context_cache_;
-    
-    // Performance optimization: pre-allocated vectors
-    thread_local std::vector<TradeData> batch_buffer_;
+
+    // Process-wide account-relationship index, shared by all shards;
+    // lock-free for both update and query
+    std::unique_ptr<AccountGraph> account_graph_ =
+        std::make_unique<AccountGraph>();
+
+    // NUMA topology: CPU list per node, empty when placement is disabled.
+    // Workers are split into contiguous groups, one per node, so shard
+    // routing (instrument_id % num_threads) also decides the owning node.
+    std::vector<std::vector<int>> numa_node_cpus_;
+
+    size_t node_of_worker(size_t worker_index) const {
+        return numa_node_cpus_.empty()
+            ? 0
+            : worker_index * numa_node_cpus_.size() / num_threads_;
+    }
+
+    MemoryPool<TradeRecord>& pool_for_worker(size_t worker_index) {
+        return *memory_pools_[node_of_worker(worker_index)];
+    }
+
+    // Per-shard historical contexts, keyed by packed (instrument, account)
+    // interned IDs. Each shard is owned by exactly one worker thread, so no
+    // synchronization is needed and contexts are mutated in place. Stores
+    // are bounded with TTL/LRU eviction, capping context memory regardless
+    // of how many pairs trade in a day.
+    std::vector<std::unique_ptr<ContextStore>> context_shards_;
+
+    // Statically-dispatched pipeline of the five built-in detectors; fixed
+    // once initialize() has run. Custom plugins stay in the dynamic registry.
+    std::unique_ptr<BuiltinDetectorPipeline> builtin_pipeline_;
+
+    // Heavyweight detector offload: trades destined for the heavy built-ins
+    // are batched per worker and executed on a small dedicated TBB arena at
+    // a granularity of kOffloadBatch trades per task. The batch carries only
+    // the trade and the scalar context aggregates - heavy detectors keep
+    // their own cross-reference state and must not depend on the rings.
+    struct HeavyWorkItem {
+        TradeRecord trade;
+        uint32_t shard_index;
+        double avg_price;
+        double avg_volume;
+        double price_volatility;
+        double account_total_volume;
+    };
+
+    // Warm-restart snapshot hand-off: the coordinator requests, the owning
+    // worker serializes its shard's window contents at a batch boundary,
+    // so the single-writer rule on contexts is never broken
+    struct alignas(64) ShardSnapshotState {
+        static constexpr uint32_t kIdle = 0;
+        static constexpr uint32_t kRequested = 1;
+        static constexpr uint32_t kReady = 2;
+
+        std::atomic<uint32_t> phase{kIdle};
+        std::vector<TradeRecord> buffer;
+    };
+
+    std::vector<std::unique_ptr<ShardSnapshotState>> snapshot_states_;
+
+    // Sampling hot-path tracer; null until configure_tracing() arms it
+    std::unique_ptr<HotPathTracer> tracer_;
+
+    // Asynchronous logging facade for the per-trade sites; control-path
+    // logging stays on spdlog directly
+    HotPathLogger hot_logger_;
+    uint32_t site_invalid_trade_ = 0;
+    uint32_t site_future_timestamp_ = 0;
+    uint32_t site_bad_values_ = 0;
+    uint32_t site_pool_exhausted_ = 0;
+    uint32_t site_queue_full_ = 0;
+    uint32_t site_alert_ = 0;
+
+    // Ingress hygiene: branchless range limits for the batch validator and
+    // the probabilistic duplicate-ID set (null until configure_dedupe())
+    simd::ValidationLimits validation_limits_;
+    std::unique_ptr<TradeDeduper> deduper_;
+    std::atomic<uint64_t> trades_rejected_{0};
+
+    // Top-of-book enrichment source, owned by the quote ingestion path;
+    // null when no quote stream is configured
+    const QuoteTable* quote_table_ = nullptr;
+
+    // Progressive wait strategies: one per worker plus one for the alert
+    // dispatcher. Producers notify the consumer's strategy after enqueue.
+    WaitProfile wait_profile_ = WaitProfile::kBalanced;
+    std::vector<std::unique_ptr<WaitStrategy>> worker_waits_;
+    std::unique_ptr<WaitStrategy> alert_wait_;
+
+    void build_wait_strategies() {
+        worker_waits_.clear();
+        for (size_t i = 0; i < num_threads_; ++i) {
+            worker_waits_.emplace_back(std::make_unique<WaitStrategy>(wait_profile_));
+        }
+        alert_wait_ = std::make_unique<WaitStrategy>(wait_profile_);
+    }
+
+    static constexpr size_t kOffloadBatch = 512;
+
+    DetectorExecutionMode execution_mode_ = DetectorExecutionMode::kInline;
+    tbb::task_arena offload_arena_{2};
+    tbb::task_group offload_group_;
+    std::vector<std::vector<HeavyWorkItem>> heavy_batches_;
 };
 
 TradePatternDetector::TradePatternDetector(size_t num_threads, size_t queue_size)
     : impl_(std::make_unique<TradeProcessorImpl>(num_threads))
     , running_(false)
     , shutdown_requested_(false)
-    , trade_queue_(queue_size)
     , config_manager_(std::make_unique<PatternConfigManager>())
     , last_stats_update_(std::chrono::high_resolution_clock::now())
-    , trades_processed_(0)
-    , alerts_generated_(0)
-    , processing_time_ns_(0)
 {
     // Reserve space for worker threads
     worker_threads_.reserve(num_threads);
-    
-    spdlog::info("TradePatternDetector initialized with {} threads, queue size: {}", 
-                 num_threads, queue_size);
+
+    // One statistics shard per worker; each is written by a single thread
+    stat_shards_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        stat_shards_.emplace_back(std::make_unique<WorkerStatShard>());
+    }
+
+    // One queue and one context shard per worker; the total queue capacity
+    // is split evenly across shards
+    size_t per_shard_capacity = std::max<size_t>(queue_size / num_threads, 1024);
+    worker_queues_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        worker_queues_.emplace_back(
+            std::make_unique<boost::lockfree::queue<TradeRecord*>>(per_shard_capacity));
+    }
+    impl_->context_shards_.reserve(num_threads);
+    impl_->snapshot_states_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        impl_->context_shards_.emplace_back(std::make_unique<ContextStore>());
+        impl_->snapshot_states_.emplace_back(
+            std::make_unique<TradeProcessorImpl::ShardSnapshotState>());
+    }
+    impl_->heavy_batches_.resize(num_threads);
+
+    spdlog::info("TradePatternDetector initialized with {} sharded workers, "
+                 "queue capacity per shard: {}",
+                 num_threads, per_shard_capacity);
 }
 
 TradePatternDetector::~TradePatternDetector() {
@@ -91,7 +358,14 @@ bool TradePatternDetector::initialize(const std::string& config_path) {
         
         // Initialize built-in pattern detectors
         initialize_builtin_detectors();
-        
+
+        // Warm restart: repopulate the context shards from the last
+        // snapshot so sliding-window detectors see full history from the
+        // first trade instead of going blind for a lookback window
+        if (!snapshot_path_.empty()) {
+            load_context_snapshot();
+        }
+
         spdlog::info("TradePatternDetector initialized successfully");
         return true;
     }
@@ -109,15 +383,23 @@ bool TradePatternDetector::start() {
     
     shutdown_requested_.store(false);
     running_.store(true);
-    
-    // Start worker threads
+
+    // Formatter first so hot-path records never sit in a ring unread
+    impl_->hot_logger_.start();
+
+    // Start worker threads, one per shard
     for (size_t i = 0; i < impl_->num_threads_; ++i) {
-        worker_threads_.emplace_back(&TradePatternDetector::worker_thread_func, this);
+        worker_threads_.emplace_back(&TradePatternDetector::worker_thread_func, this, i);
     }
     
     // Start alert dispatcher thread
     alert_dispatcher_thread_ = std::thread(&TradePatternDetector::alert_dispatcher_func, this);
-    
+
+    // Periodic warm-restart snapshots
+    if (!snapshot_path_.empty() && snapshot_interval_.count() > 0) {
+        snapshot_thread_ = std::thread(&TradePatternDetector::snapshot_thread_func, this);
+    }
+
     spdlog::info("TradePatternDetector started with {} worker threads", impl_->num_threads_);
     return true;
 }
@@ -128,10 +410,26 @@ void TradePatternDetector::stop() {
     }
     
     spdlog::info("Stopping TradePatternDetector...");
-    
+
+    // Final snapshot while the workers are still alive to serialize their
+    // shards; the next start loads it for a gapless restart
+    if (!snapshot_path_.empty()) {
+        save_context_snapshot();
+    }
+
     shutdown_requested_.store(true);
     running_.store(false);
-    
+
+    // Wake any parked consumers so they observe the shutdown promptly
+    for (auto& wait : impl_->worker_waits_) {
+        wait->notify();
+    }
+    impl_->alert_wait_->notify();
+
+    if (snapshot_thread_.joinable()) {
+        snapshot_thread_.join();
+    }
+
     // Wait for all worker threads to finish
     for (auto& thread : worker_threads_) {
         if (thread.joinable()) {
@@ -139,13 +437,20 @@ void TradePatternDetector::stop() {
         }
     }
     
+    // Drain outstanding heavyweight offload tasks before the dispatcher
+    // stops so their alerts still reach the callback
+    impl_->offload_arena_.execute([this] { impl_->offload_group_.wait(); });
+
     // Stop alert dispatcher
     if (alert_dispatcher_thread_.joinable()) {
         alert_dispatcher_thread_.join();
     }
     
     worker_threads_.clear();
-    
+
+    // All producers are quiescent; flush the remaining hot-path records
+    impl_->hot_logger_.stop();
+
     // Log final statistics
     auto stats = get_statistics();
     spdlog::info("TradePatternDetector stopped. Final stats - Trades: {}, Alerts: {}, "
@@ -161,25 +466,45 @@ bool TradePatternDetector::process_trade(const TradeData& trade) {
     }
     
     if (!validate_trade_data(trade)) {
-        spdlog::warn("Invalid trade data received: {}", trade.trade_id);
+        impl_->hot_logger_.log(impl_->site_invalid_trade_, 0, 0,
+                               trade.trade_id.c_str());
         return false;
     }
-    
-    // Allocate trade from memory pool for zero-copy processing
-    TradeData* pooled_trade = impl_->memory_pool_->allocate();
-    if (!pooled_trade) {
-        spdlog::error("Memory pool exhausted, dropping trade: {}", trade.trade_id);
+
+    // Drop Kafka redeliveries before they cost a detection pass
+    if (impl_->deduper_ && impl_->deduper_->check_and_insert(trade.trade_id.c_str())) {
         return false;
     }
-    
-    *pooled_trade = trade;
-    
-    // Push to lock-free queue
-    if (!trade_queue_.push(pooled_trade)) {
-        impl_->memory_pool_->deallocate(pooled_trade);
-        spdlog::warn("Trade queue full, dropping trade: {}", trade.trade_id);
+
+    // Intern identifiers and fill the POD record; this is the last point
+    // where the string form of the trade is touched on the hot path. Built
+    // on the stack first because the owning shard - and with it the NUMA
+    // node whose pool should hold the record - depends on the interned
+    // instrument ID.
+    TradeRecord record;
+    make_trade_record(trade, record);
+
+    // Route to the worker shard owning this instrument so its context is
+    // only ever touched by one thread
+    size_t shard_index = record.instrument_id % worker_queues_.size();
+
+    // Allocate from the pool local to the shard's node; the pool spills to
+    // its overflow tier before this can fail
+    TradeRecord* pooled_record = impl_->pool_for_worker(shard_index).allocate();
+    if (!pooled_record) {
+        impl_->hot_logger_.log(impl_->site_pool_exhausted_, 0, 0,
+                               trade.trade_id.c_str());
+        return false;
+    }
+    *pooled_record = record;
+
+    if (!worker_queues_[shard_index]->push(pooled_record)) {
+        impl_->pool_for_worker(shard_index).deallocate(pooled_record);
+        impl_->hot_logger_.log(impl_->site_queue_full_, shard_index, 0,
+                               trade.trade_id.c_str());
         return false;
     }
+    impl_->worker_waits_[shard_index]->notify();
     
     return true;
 }
@@ -189,27 +514,86 @@ size_t TradePatternDetector::process_trades_batch(const std::vector<TradeData>&
         return 0;
     }
     
-    size_t successful_count = 0;
-    
-    // Process trades in parallel for validation
-    std::vector<bool> validation_results(trades.size());
-    
+    if (trades.empty()) {
+        return 0;
+    }
+
+    // Intern identifiers in parallel - the only per-element string work
+    // left on this path. Range validation and dedupe happen on the POD
+    // records in process_records_batch, branchless across lanes, instead
+    // of the old per-element validate-then-process_trade funnel.
+    static thread_local std::vector<TradeRecord> records;
+    records.resize(trades.size());
+
     tbb::parallel_for(tbb::blocked_range<size_t>(0, trades.size()),
         [&](const tbb::blocked_range<size_t>& range) {
             for (size_t i = range.begin(); i != range.end(); ++i) {
-                validation_results[i] = validate_trade_data(trades[i]);
+                make_trade_record(trades[i], records[i]);
             }
         });
-    
-    // Queue valid trades
-    for (size_t i = 0; i < trades.size(); ++i) {
-        if (validation_results[i]) {
-            if (process_trade(trades[i])) {
-                ++successful_count;
-            }
+
+    return process_records_batch(records.data(), records.size());
+}
+
+size_t TradePatternDetector::process_records_batch(const TradeRecord* records, size_t count) {
+    if (!running_.load()) {
+        return 0;
+    }
+
+    // Stage the batch as columns and range-check every element with the
+    // SIMD validator; one aggregate counter instead of per-element warns
+    static thread_local simd::ValidationColumns columns;
+    static thread_local std::vector<uint8_t> valid;
+    columns.assign(records, count);
+    valid.resize(count);
+
+    int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    size_t valid_count = simd::validate_batch(columns, impl_->validation_limits_,
+                                              now_ns, valid.data());
+    if (valid_count < count) {
+        impl_->trades_rejected_.fetch_add(count - valid_count,
+                                          std::memory_order_relaxed);
+    }
+
+    size_t successful_count = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!valid[i]) {
+            continue;
+        }
+        // Empty instrument symbols intern to kInvalidId and would build a
+        // zero context key; the single-trade path rejects them in
+        // is_valid() and the snapshot loader skips them on restore, so
+        // hold the batch path to the same rule
+        if (records[i].instrument_id == StringInterner::kInvalidId) {
+            impl_->trades_rejected_.fetch_add(1, std::memory_order_relaxed);
+            continue;
         }
+        if (impl_->deduper_ &&
+            impl_->deduper_->check_and_insert(records[i].trade_id)) {
+            continue;
+        }
+
+        size_t shard_index = records[i].instrument_id % worker_queues_.size();
+
+        TradeRecord* pooled_record = impl_->pool_for_worker(shard_index).allocate();
+        if (!pooled_record) {
+            spdlog::error("Memory pool and overflow tier exhausted, dropping record batch "
+                          "remainder ({} of {} queued)", successful_count, count);
+            break;
+        }
+
+        *pooled_record = records[i];
+
+        if (!worker_queues_[shard_index]->push(pooled_record)) {
+            impl_->pool_for_worker(shard_index).deallocate(pooled_record);
+            continue;
+        }
+        impl_->worker_waits_[shard_index]->notify();
+        ++successful_count;
     }
-    
+
     return successful_count;
 }
 
@@ -218,31 +602,99 @@ void TradePatternDetector::register_pattern_detector(
     std::shared_ptr<IPatternDetector> detector) {
     
     detectors_[pattern_name] = std::move(detector);
+    if (impl_->tracer_) {
+        impl_->tracer_->register_detector(pattern_name);
+    }
     spdlog::info("Registered pattern detector: {}", pattern_name);
 }
 
 ProcessingStats TradePatternDetector::get_statistics() const {
-    std::lock_guard<std::mutex> lock(stats_mutex_);
-    
-    ProcessingStats stats = statistics_;
-    
-    // Update real-time counters
-    stats.total_trades_processed = trades_processed_.load();
-    stats.total_alerts_generated = alerts_generated_.load();
-    stats.queue_size = trade_queue_.read_available();
-    
+    ProcessingStats stats;
+
+    // Aggregate the per-worker shards lock-free; each shard is only ever
+    // written by its owning worker, so relaxed reads are sufficient
+    uint64_t total_processing_time = 0;
+    std::array<uint64_t, LatencyHistogram::kBucketCount> histogram_counts{};
+    std::array<uint64_t, LatencyHistogram::kBucketCount> residency_counts{};
+
+    for (const auto& shard : stat_shards_) {
+        stats.total_trades_processed += shard->trades_processed.load(std::memory_order_relaxed);
+        stats.total_alerts_generated += shard->alerts_generated.load(std::memory_order_relaxed);
+        total_processing_time += shard->processing_time_ns.load(std::memory_order_relaxed);
+        stats.peak_processing_time_ns = std::max(
+            stats.peak_processing_time_ns,
+            shard->peak_processing_time_ns.load(std::memory_order_relaxed));
+        shard->latency_histogram.accumulate_into(histogram_counts);
+        shard->ingress_residency_histogram.accumulate_into(residency_counts);
+    }
+
+    if (stats.total_trades_processed > 0) {
+        stats.avg_processing_time_ns = total_processing_time / stats.total_trades_processed;
+    }
+
+    stats.p50_processing_time_ns = LatencyHistogram::quantile(histogram_counts, 0.50);
+    stats.p99_processing_time_ns = LatencyHistogram::quantile(histogram_counts, 0.99);
+    stats.p999_processing_time_ns = LatencyHistogram::quantile(histogram_counts, 0.999);
+
+    stats.ingress_to_dequeue_p50_ns = LatencyHistogram::quantile(residency_counts, 0.50);
+    stats.ingress_to_dequeue_p99_ns = LatencyHistogram::quantile(residency_counts, 0.99);
+
+    std::array<uint64_t, LatencyHistogram::kBucketCount> dispatch_counts{};
+    alert_dispatch_histogram_.accumulate_into(dispatch_counts);
+    stats.ingress_to_dispatch_p50_ns = LatencyHistogram::quantile(dispatch_counts, 0.50);
+    stats.ingress_to_dispatch_p99_ns = LatencyHistogram::quantile(dispatch_counts, 0.99);
+
+    stats.queue_size = 0;
+    for (const auto& queue : worker_queues_) {
+        stats.queue_size += queue->read_available();
+    }
+
+    // Context store health; counters are owned by the workers, so these
+    // are monitoring-grade reads, not exact snapshots
+    size_t contexts_held = 0;
+    size_t context_capacity = 0;
+    for (const auto& store : impl_->context_shards_) {
+        contexts_held += store->size();
+        context_capacity += store->capacity();
+        stats.context_lru_evictions += store->lru_evictions();
+    }
+    if (context_capacity > 0) {
+        stats.context_store_occupancy =
+            static_cast<double>(contexts_held) / static_cast<double>(context_capacity);
+    }
+
+    stats.alert_high_lane_depth = alert_lanes_.high_depth.load(std::memory_order_relaxed);
+    stats.alert_low_lane_depth = alert_lanes_.low_depth.load(std::memory_order_relaxed);
+    stats.alerts_collapsed = alert_lanes_.collapsed.load(std::memory_order_relaxed);
+
+    stats.trades_rejected = impl_->trades_rejected_.load(std::memory_order_relaxed);
+    if (impl_->deduper_) {
+        stats.duplicates_suppressed = impl_->deduper_->duplicates();
+    }
+
+    // Per-pattern time from the sampling tracer, scaled back up by the
+    // sample rate to an estimated wall total
+    if (impl_->tracer_) {
+        impl_->tracer_->drain();
+        auto trace = impl_->tracer_->report();
+        for (const auto& detector : trace.detectors) {
+            stats.pattern_processing_time_ns[detector.name] =
+                detector.total_ns * trace.sample_rate;
+        }
+    }
+
     // Calculate throughput
     auto now = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::seconds>(
         now - last_stats_update_).count();
-    
+
     if (duration > 0) {
-        stats.throughput_trades_per_second = 
+        stats.throughput_trades_per_second =
             static_cast<double>(stats.total_trades_processed) / duration;
     }
-    
+
     stats.last_updated = std::chrono::system_clock::now();
-    
+
     return stats;
 }
 
@@ -251,7 +703,30 @@ void TradePatternDetector::set_alert_callback(
     alert_callback_ = std::move(callback);
 }
 
+void TradePatternDetector::set_trade_sink(
+    std::function<void(const TradeRecord&, size_t)> sink) {
+    trade_sink_ = std::move(sink);
+}
+
+void TradePatternDetector::set_quote_table(const QuoteTable* table) {
+    if (running_.load()) {
+        spdlog::warn("Quote table must be attached before start(), ignoring");
+        return;
+    }
+    impl_->quote_table_ = table;
+    if (table) {
+        spdlog::info("Quote enrichment attached: {} instrument slots",
+                     table->capacity());
+    }
+}
+
 void TradePatternDetector::toggle_pattern(const std::string& pattern_name, bool enabled) {
+    if (impl_->builtin_pipeline_ &&
+        impl_->builtin_pipeline_->set_enabled(pattern_name, enabled)) {
+        spdlog::info("Pattern {} {}", pattern_name, enabled ? "enabled" : "disabled");
+        return;
+    }
+
     auto it = detectors_.find(pattern_name);
     if (it != detectors_.end()) {
         it->second->set_enabled(enabled);
@@ -264,7 +739,19 @@ void TradePatternDetector::toggle_pattern(const std::string& pattern_name, bool
 void TradePatternDetector::update_pattern_config(
     const std::string& pattern_name,
     const PatternConfig& config) {
-    
+
+    if (impl_->builtin_pipeline_ &&
+        impl_->builtin_pipeline_->update_config(pattern_name, config)) {
+        if (impl_->builtin_pipeline_->profile() != ConfigProfile::kRuntime) {
+            spdlog::warn("Pattern {} runs under the {} profile; the updated "
+                         "config only applies after switching back to runtime",
+                         pattern_name,
+                         config_profile_name(impl_->builtin_pipeline_->profile()));
+        }
+        spdlog::info("Updated configuration for pattern: {}", pattern_name);
+        return;
+    }
+
     auto it = detectors_.find(pattern_name);
     if (it != detectors_.end()) {
         it->second->update_config(config);
@@ -274,140 +761,684 @@ void TradePatternDetector::update_pattern_config(
     }
 }
 
-void TradePatternDetector::worker_thread_func() {
-    spdlog::debug("Worker thread started: {}", std::this_thread::get_id());
-    
-    TradeData* trade = nullptr;
-    
-    while (running_.load() || !trade_queue_.empty()) {
-        if (trade_queue_.pop(trade)) {
-            if (trade) {
-                auto start_time = std::chrono::high_resolution_clock::now();
-                
-                process_trade_internal(*trade);
-                
-                auto end_time = std::chrono::high_resolution_clock::now();
-                auto processing_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                    end_time - start_time).count();
-                
-                // Update performance metrics
-                processing_time_ns_.fetch_add(processing_time);
-                
-                // Update peak processing time
-                uint64_t current_peak = peak_processing_time_ns_.load();
-                while (processing_time > current_peak &&
-                       !peak_processing_time_ns_.compare_exchange_weak(current_peak, processing_time)) {
-                    // Retry until successful or no longer the peak
+void TradePatternDetector::worker_thread_func(size_t worker_index) {
+    spdlog::debug("Worker thread {} started: {}", worker_index, std::this_thread::get_id());
+
+    // Pin to the CPUs of this worker's NUMA node so the shard's contexts,
+    // queue and pool slabs stay node-local for the thread's lifetime
+    if (!impl_->numa_node_cpus_.empty()) {
+        size_t node = impl_->node_of_worker(worker_index);
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (int cpu : impl_->numa_node_cpus_[node]) {
+            CPU_SET(cpu, &cpu_set);
+        }
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+            spdlog::warn("Failed to pin worker {} to NUMA node {}", worker_index, node);
+        } else {
+            spdlog::debug("Worker {} pinned to NUMA node {}", worker_index, node);
+        }
+    }
+
+    // Drain up to a full batch per iteration so clock reads and the shared
+    // atomic statistics are amortized across many trades instead of being
+    // paid per element
+    constexpr size_t kMaxBatchSize = 256;
+    std::array<TradeRecord*, kMaxBatchSize> batch;
+
+    auto& queue = *worker_queues_[worker_index];
+    auto& wait = *impl_->worker_waits_[worker_index];
+
+    HotPathTracer* tracer = impl_->tracer_.get();
+
+    while (running_.load() || !queue.empty()) {
+        // Dequeue stage is sampled per batch with the same counter the
+        // per-trade stages use
+        const bool trace_dequeue = tracer && tracer->should_sample(worker_index);
+        uint64_t dequeue_start = trace_dequeue ? read_tsc() : 0;
+
+        size_t batch_size = 0;
+        TradeRecord* trade = nullptr;
+        while (batch_size < kMaxBatchSize && queue.pop(trade)) {
+            batch[batch_size++] = trade;
+        }
+
+        if (batch_size > 0) {
+            if (trace_dequeue) {
+                tracer->record(worker_index, TraceStage::kDequeue,
+                               (read_tsc() - dequeue_start) / batch_size);
+            }
+
+            // Queue residency against the ingress stamp, read once and
+            // amortized over the batch; recorded before detection so the
+            // histogram isolates the wait in front of the workers
+            const int64_t dequeue_ns = ingress_now_ns();
+
+            wait.reset();
+            auto start_time = std::chrono::high_resolution_clock::now();
+
+            for (size_t i = 0; i < batch_size; ++i) {
+                const bool sampled =
+                    tracer && tracer->should_sample(worker_index);
+                process_trade_internal(*batch[i], worker_index, sampled);
+                if (trade_sink_) {
+                    trade_sink_(*batch[i], worker_index);
                 }
-                
-                trades_processed_.fetch_add(1);
-                
-                // Return trade to memory pool
-                impl_->memory_pool_->deallocate(trade);
+            }
+
+            auto end_time = std::chrono::high_resolution_clock::now();
+            auto batch_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                end_time - start_time).count();
+            uint64_t per_trade_time = static_cast<uint64_t>(batch_time) / batch_size;
+
+            // One round of shard-local statistics updates for the whole
+            // batch; the shard is only written by this thread, so there is
+            // no cross-core contention and no CAS loop
+            WorkerStatShard& shard_stats = *stat_shards_[worker_index];
+            shard_stats.processing_time_ns.fetch_add(batch_time, std::memory_order_relaxed);
+            shard_stats.trades_processed.fetch_add(batch_size, std::memory_order_relaxed);
+            shard_stats.latency_histogram.record(per_trade_time, batch_size);
+
+            for (size_t i = 0; i < batch_size; ++i) {
+                int64_t ingress = batch[i]->ingress_ns;
+                if (ingress > 0 && dequeue_ns > ingress) {
+                    shard_stats.ingress_residency_histogram.record(
+                        static_cast<uint64_t>(dequeue_ns - ingress));
+                }
+            }
+
+            if (per_trade_time > shard_stats.peak_processing_time_ns.load(std::memory_order_relaxed)) {
+                shard_stats.peak_processing_time_ns.store(per_trade_time, std::memory_order_relaxed);
+            }
+
+            // Return the whole batch to this node's memory pool
+            for (size_t i = 0; i < batch_size; ++i) {
+                impl_->pool_for_worker(worker_index).deallocate(batch[i]);
             }
         } else {
-            // No trades available, yield to avoid busy waiting
-            std::this_thread::yield();
+            // Quiet shard: submit any partial heavyweight batch before
+            // parking, so offloaded detection is never deferred past the
+            // moment there is nothing left to fill the batch with
+            if (impl_->execution_mode_ == DetectorExecutionMode::kOffloadHeavy) {
+                flush_heavy_batch(worker_index);
+            }
+
+            // No trades available; spin, then yield, then park until a
+            // producer notifies - profile-dependent
+            wait.idle();
+        }
+
+        // Serve a pending snapshot request at the batch boundary: copy the
+        // shard's window contents out, then let the coordinator collect.
+        // One relaxed load per drain iteration when no snapshot is pending.
+        auto& snapshot_state = *impl_->snapshot_states_[worker_index];
+        if (snapshot_state.phase.load(std::memory_order_acquire) ==
+            TradeProcessorImpl::ShardSnapshotState::kRequested) {
+            snapshot_state.buffer.clear();
+            impl_->context_shards_[worker_index]->for_each_context(
+                [&snapshot_state](uint64_t, const HistoricalContext& context) {
+                    for (size_t i = 0; i < context.recent_trades.size(); ++i) {
+                        snapshot_state.buffer.push_back(context.recent_trades[i]);
+                    }
+                });
+            snapshot_state.phase.store(TradeProcessorImpl::ShardSnapshotState::kReady,
+                                       std::memory_order_release);
         }
     }
-    
-    spdlog::debug("Worker thread finished: {}", std::this_thread::get_id());
+
+    // Submit any partial heavyweight batch before exiting
+    if (impl_->execution_mode_ == DetectorExecutionMode::kOffloadHeavy) {
+        flush_heavy_batch(worker_index);
+    }
+
+    spdlog::debug("Worker thread {} finished: {}", worker_index, std::this_thread::get_id());
 }
 
 void TradePatternDetector::alert_dispatcher_func() {
     spdlog::debug("Alert dispatcher thread started");
     
     SurveillanceAlert alert;
-    
-    while (running_.load() || !alert_queue_.empty()) {
-        if (alert_queue_.try_pop(alert)) {
-            if (alert_callback_) {
-                try {
-                    alert_callback_(alert);
-                } catch (const std::exception& e) {
-                    spdlog::error("Error in alert callback: {}", e.what());
-                }
+    auto& wait = *impl_->alert_wait_;
+    auto& lanes = alert_lanes_;
+
+    auto dispatch = [this](const SurveillanceAlert& ready) {
+        if (ready.ingress_ns > 0) {
+            int64_t now = ingress_now_ns();
+            if (now > ready.ingress_ns) {
+                alert_dispatch_histogram_.record(
+                    static_cast<uint64_t>(now - ready.ingress_ns));
+            }
+        }
+        if (alert_callback_) {
+            try {
+                alert_callback_(ready);
+            } catch (const std::exception& e) {
+                spdlog::error("Error in alert callback: {}", e.what());
             }
-        } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
         }
+    };
+
+    while (running_.load() || !lanes.high.empty() || !lanes.low.empty()) {
+        // Strict priority: the high lane is drained before any low alert
+        // is even considered, so HIGH/CRITICAL latency is independent of
+        // low-severity storm depth
+        if (lanes.high.try_pop(alert)) {
+            lanes.high_depth.fetch_sub(1, std::memory_order_relaxed);
+            wait.reset();
+            dispatch(alert);
+            continue;
+        }
+
+        if (lanes.low.try_pop(alert)) {
+            lanes.low_depth.fetch_sub(1, std::memory_order_relaxed);
+            wait.reset();
+            dispatch(alert);
+            continue;
+        }
+
+        // Idle moment: turn any shed low alerts into summaries
+        flush_shed_low_alerts();
+        wait.idle();
     }
-    
+
+    flush_shed_low_alerts();
+
     spdlog::debug("Alert dispatcher thread finished");
 }
 
-void TradePatternDetector::process_trade_internal(const TradeData& trade) {
-    // Get or create historical context for the instrument
-    HistoricalContext context;
-    auto context_key = trade.instrument_symbol + "_" + trade.account_id;
-    
-    auto context_it = impl_->context_cache_.find(context_key);
-    if (context_it != impl_->context_cache_.end()) {
-        context = context_it->second;
+void TradePatternDetector::enqueue_alert(SurveillanceAlert&& alert) {
+    auto& lanes = alert_lanes_;
+
+    if (alert.severity >= AlertSeverity::HIGH) {
+        lanes.high.push(std::move(alert));
+        lanes.high_depth.fetch_add(1, std::memory_order_relaxed);
+        impl_->alert_wait_->notify();
+        return;
+    }
+
+    // Low lane sheds under storm: collapse per type rather than queue
+    // thousands of near-duplicates in front of the dispatcher
+    if (lanes.low_depth.load(std::memory_order_relaxed) >= low_lane_shed_threshold_) {
+        shed_low_alerts_[alert.alert_type].fetch_add(1, std::memory_order_relaxed);
+        lanes.collapsed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    lanes.low.push(std::move(alert));
+    lanes.low_depth.fetch_add(1, std::memory_order_relaxed);
+    impl_->alert_wait_->notify();
+}
+
+void TradePatternDetector::flush_shed_low_alerts() {
+    for (auto& [alert_type, count] : shed_low_alerts_) {
+        uint64_t collapsed = count.exchange(0, std::memory_order_relaxed);
+        if (collapsed == 0) {
+            continue;
+        }
+
+        SurveillanceAlert summary;
+        summary.alert_type = alert_type;
+        summary.severity = AlertSeverity::LOW;
+        summary.title = "Collapsed " + std::to_string(collapsed) +
+                        " low-severity alerts";
+        summary.description = std::to_string(collapsed) + " " + alert_type +
+                              " alerts were collapsed while the low-severity "
+                              "lane was shedding load";
+
+        if (alert_callback_) {
+            try {
+                alert_callback_(summary);
+            } catch (const std::exception& e) {
+                spdlog::error("Error in alert callback: {}", e.what());
+            }
+        }
+    }
+}
+
+void TradePatternDetector::set_alert_shed_threshold(size_t threshold) {
+    low_lane_shed_threshold_ = threshold;
+    spdlog::info("Low alert lane shed threshold: {}", threshold);
+}
+
+void TradePatternDetector::configure_dedupe(size_t capacity) {
+    if (running_.load()) {
+        spdlog::warn("Dedupe must be configured before start(), ignoring");
+        return;
+    }
+
+    if (capacity == 0) {
+        impl_->deduper_.reset();
+        spdlog::info("Duplicate-trade suppression disabled");
+        return;
+    }
+
+    impl_->deduper_ = std::make_unique<TradeDeduper>(capacity);
+    spdlog::info("Duplicate-trade suppression: {} fingerprint slots",
+                 impl_->deduper_->capacity());
+}
+
+void TradePatternDetector::configure_tracing(size_t sample_rate) {
+    if (running_.load()) {
+        spdlog::warn("Tracing must be configured before start(), ignoring");
+        return;
+    }
+
+    if (sample_rate == 0) {
+        impl_->tracer_.reset();
+        spdlog::info("Hot-path tracing disabled");
+        return;
+    }
+
+    impl_->tracer_ = std::make_unique<HotPathTracer>(impl_->num_threads_, sample_rate);
+
+    // Register the fixed built-in set plus whatever plugins exist already;
+    // later register_pattern_detector() calls add themselves
+    if (impl_->builtin_pipeline_) {
+        impl_->builtin_pipeline_->for_each_name([this](const std::string& name) {
+            impl_->tracer_->register_detector(name);
+        });
     }
-    
-    // Update context with current trade
-    context.recent_trades.push_back(trade);
-    
-    // Keep only recent trades (sliding window)
-    auto cutoff_time = trade.timestamp - context.lookback_window;
-    context.recent_trades.erase(
-        std::remove_if(context.recent_trades.begin(), context.recent_trades.end(),
-                      [cutoff_time](const TradeData& t) {
-                          return t.timestamp < cutoff_time;
-                      }),
-        context.recent_trades.end());
-    
-    // Update context cache
-    impl_->context_cache_[context_key] = context;
-    
-    // Run all enabled pattern detectors in parallel
-    std::vector<std::pair<std::string, std::shared_ptr<IPatternDetector>>> enabled_detectors;
     for (const auto& [name, detector] : detectors_) {
-        if (detector->is_enabled()) {
-            enabled_detectors.emplace_back(name, detector);
+        impl_->tracer_->register_detector(name);
+    }
+}
+
+void TradePatternDetector::set_pattern_budget(const std::string& pattern_name,
+                                              std::chrono::nanoseconds budget) {
+    if (!impl_->tracer_) {
+        spdlog::warn("Pattern budgets require tracing, call configure_tracing() first");
+        return;
+    }
+
+    uint64_t budget_ns = static_cast<uint64_t>(budget.count());
+    if (pattern_name == "*") {
+        if (impl_->builtin_pipeline_) {
+            impl_->builtin_pipeline_->for_each_name(
+                [this, budget_ns](const std::string& name) {
+                    impl_->tracer_->set_budget(name, budget_ns);
+                });
+        }
+        for (const auto& [name, detector] : detectors_) {
+            impl_->tracer_->set_budget(name, budget_ns);
         }
+        return;
     }
-    
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, enabled_detectors.size()),
-        [&](const tbb::blocked_range<size_t>& range) {
-            for (size_t i = range.begin(); i != range.end(); ++i) {
-                const auto& [name, detector] = enabled_detectors[i];
-                
+
+    impl_->tracer_->set_budget(pattern_name, budget_ns);
+}
+
+void TradePatternDetector::set_budget_policy(uint32_t max_violations,
+                                             std::chrono::seconds window,
+                                             bool auto_throttle) {
+    budget_max_violations_ = max_violations;
+    budget_window_ = window;
+    budget_auto_throttle_ = auto_throttle;
+    spdlog::info("Pattern budget policy: {} violations per {}s{}",
+                 max_violations, window.count(),
+                 auto_throttle ? ", auto-throttle" : "");
+}
+
+void TradePatternDetector::enforce_pattern_budgets() {
+    if (!impl_->tracer_) {
+        return;
+    }
+
+    impl_->tracer_->drain();
+
+    auto now = std::chrono::steady_clock::now();
+    for (const auto& [name, count] : impl_->tracer_->take_budget_violations()) {
+        BudgetWindow& window = budget_windows_[name];
+        if (window.window_start == std::chrono::steady_clock::time_point{} ||
+            now - window.window_start >= budget_window_) {
+            window.window_start = now;
+            window.violations = 0;
+        }
+        window.violations += count;
+
+        if (window.violations <= budget_max_violations_ || window.throttled) {
+            continue;
+        }
+
+        if (budget_auto_throttle_) {
+            spdlog::warn("Pattern {} exceeded its time budget {} times in the "
+                         "current window, throttling via toggle_pattern()",
+                         name, window.violations);
+            window.throttled = true;
+            toggle_pattern(name, false);
+        } else {
+            spdlog::warn("Pattern {} exceeded its time budget {} times in the "
+                         "current window", name, window.violations);
+        }
+    }
+}
+
+HotPathTracer::Report TradePatternDetector::get_trace_report() const {
+    if (!impl_->tracer_) {
+        return {};
+    }
+    impl_->tracer_->drain();
+    return impl_->tracer_->report();
+}
+
+void TradePatternDetector::process_trade_internal(const TradeRecord& trade, size_t shard_index,
+                                                  bool sampled) {
+    HotPathTracer* tracer = sampled ? impl_->tracer_.get() : nullptr;
+
+    // Get or create the historical context for the (instrument, account)
+    // pair. The shard is owned by this worker thread exclusively, so the
+    // context is mutated in place without copies or synchronization.
+    uint64_t context_start = tracer ? read_tsc() : 0;
+    uint64_t context_key = (static_cast<uint64_t>(trade.instrument_id) << 32) |
+                           trade.account_id;
+    HistoricalContext& context =
+        impl_->context_shards_[shard_index]->get_or_create(context_key, trade.timestamp);
+
+    // Fold the trade into the ring-buffer window; expiry and the rolling
+    // price/volume aggregates are all O(1) amortized
+    context.add_trade(trade);
+
+    // Top-of-book enrichment: a seqlock read off the instrument's slot;
+    // the layering and front-running detectors key off these fields
+    if (impl_->quote_table_) {
+        TopOfBook quote;
+        if (impl_->quote_table_->read(trade.instrument_id, quote)) {
+            context.bid_price = quote.bid_price;
+            context.ask_price = quote.ask_price;
+            context.bid_quantity = quote.bid_quantity;
+            context.ask_quantity = quote.ask_quantity;
+        }
+    }
+
+    // Keep the relationship index current and visible to the detectors
+    impl_->account_graph_->observe_trade(trade);
+    context.account_graph = impl_->account_graph_.get();
+
+    if (tracer) {
+        tracer->record(shard_index, TraceStage::kContextUpdate,
+                       read_tsc() - context_start);
+    }
+
+    auto emit_alert = [this, shard_index, tracer, &trade](const std::string& name,
+                                                          SurveillanceAlert&& alert) {
+        impl_->hot_logger_.log(impl_->site_alert_, trade.instrument_id,
+                               trade.account_id, name.c_str());
+        // Carry the ingress stamp so the dispatcher and the alert handler
+        // can report latency against the original receive time
+        alert.ingress_ns = trade.ingress_ns;
+        uint64_t enqueue_start = tracer ? read_tsc() : 0;
+        enqueue_alert(std::move(alert));
+        if (tracer) {
+            tracer->record(shard_index, TraceStage::kAlertEnqueue,
+                           read_tsc() - enqueue_start);
+        }
+        stat_shards_[shard_index]->alerts_generated.fetch_add(
+            1, std::memory_order_relaxed);
+    };
+
+    // Built-in detectors: direct, devirtualized calls through the static
+    // pipeline - no per-trade detector vector, refcounting or indirection.
+    // Sampled trades take the traced variant that brackets each detector.
+    // In offload mode the heavyweight built-ins are deferred into a batch
+    // executed on the dedicated work-stealing pool.
+    try {
+        if (impl_->execution_mode_ == DetectorExecutionMode::kInline) {
+            if (tracer) {
+                impl_->builtin_pipeline_->run_traced(
+                    trade, context, emit_alert,
+                    [tracer, shard_index](const std::string& name, uint64_t cycles) {
+                        tracer->record_detector(shard_index, name, cycles);
+                    });
+            } else {
+                impl_->builtin_pipeline_->run(trade, context, emit_alert);
+            }
+        } else {
+            impl_->builtin_pipeline_->run_light(trade, context, emit_alert);
+
+            auto& batch = impl_->heavy_batches_[shard_index];
+            batch.push_back({trade, static_cast<uint32_t>(shard_index),
+                             context.avg_price, context.avg_volume,
+                             context.price_volatility, context.account_total_volume});
+            if (batch.size() >= TradeProcessorImpl::kOffloadBatch) {
+                flush_heavy_batch(shard_index);
+            }
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("Error in built-in detector pipeline: {}", e.what());
+    }
+
+    // Custom plugin detectors from the dynamic registry (rare)
+    for (const auto& [name, detector] : detectors_) {
+        if (!detector->is_enabled()) {
+            continue;
+        }
+        try {
+            uint64_t detector_start = tracer ? read_tsc() : 0;
+            auto alert_opt = detector->detect_pattern(trade, context);
+            if (tracer) {
+                tracer->record_detector(shard_index, name,
+                                        read_tsc() - detector_start);
+            }
+            if (alert_opt) {
+                emit_alert(name, std::move(*alert_opt));
+            }
+        } catch (const std::exception& e) {
+            spdlog::error("Error in pattern detector {}: {}", name, e.what());
+        }
+    }
+}
+
+void TradePatternDetector::set_config_profile(ConfigProfile profile) {
+    if (!impl_->builtin_pipeline_) {
+        spdlog::warn("Config profile requires an initialized pipeline, ignoring");
+        return;
+    }
+
+    impl_->builtin_pipeline_->set_profile(profile);
+    spdlog::info("Detector config profile: {}", config_profile_name(profile));
+}
+
+void TradePatternDetector::set_execution_mode(DetectorExecutionMode mode) {
+    impl_->execution_mode_ = mode;
+    spdlog::info("Detector execution mode: {}",
+                 mode == DetectorExecutionMode::kInline ? "inline" : "offload_heavy");
+}
+
+void TradePatternDetector::set_wait_profile(WaitProfile profile) {
+    if (running_.load()) {
+        spdlog::warn("Wait profile must be set before start(), ignoring");
+        return;
+    }
+
+    impl_->wait_profile_ = profile;
+    impl_->build_wait_strategies();
+
+    const char* name = profile == WaitProfile::kLatencyCritical ? "latency_critical"
+                     : profile == WaitProfile::kPowerSaving     ? "power_saving"
+                                                                : "balanced";
+    spdlog::info("Wait profile: {}", name);
+}
+
+void TradePatternDetector::set_numa_topology(const std::vector<std::vector<int>>& node_cpus) {
+    if (running_.load()) {
+        spdlog::warn("NUMA topology must be set before start(), ignoring");
+        return;
+    }
+    if (node_cpus.empty()) {
+        return;
+    }
+
+    impl_->numa_node_cpus_ = node_cpus;
+
+    // Re-provision the arenas one-per-node; each node's workers refill
+    // from and return to their local pool, so slab pages are first-touched
+    // and thereafter accessed on the owning socket
+    size_t node_count = node_cpus.size();
+    size_t arena_per_node = std::max<size_t>(1000000 / node_count, 65536);
+    size_t overflow_per_node =
+        std::max<size_t>(impl_->num_threads_ / node_count, 1) * 65536;
+
+    impl_->memory_pools_.clear();
+    for (size_t node = 0; node < node_count; ++node) {
+        impl_->memory_pools_.emplace_back(std::make_unique<MemoryPool<TradeRecord>>(
+            arena_per_node, overflow_per_node));
+    }
+
+    spdlog::info("NUMA placement enabled: {} nodes, {} workers per node",
+                 node_count, impl_->num_threads_ / node_count);
+}
+
+void TradePatternDetector::configure_snapshots(const std::string& path,
+                                               std::chrono::seconds interval) {
+    snapshot_path_ = path;
+    snapshot_interval_ = interval;
+    spdlog::info("Context snapshots armed: {} every {}s", path, interval.count());
+}
+
+bool TradePatternDetector::snapshot_now() {
+    if (snapshot_path_.empty()) {
+        spdlog::warn("Snapshot requested but no snapshot path is configured");
+        return false;
+    }
+    if (!running_.load()) {
+        spdlog::warn("Snapshot requested while stopped; workers must be "
+                     "running to serialize their shards");
+        return false;
+    }
+    return save_context_snapshot();
+}
+
+void TradePatternDetector::snapshot_thread_func() {
+    spdlog::debug("Snapshot thread started");
+
+    auto next_snapshot = std::chrono::steady_clock::now() + snapshot_interval_;
+    while (running_.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (std::chrono::steady_clock::now() < next_snapshot) {
+            continue;
+        }
+
+        save_context_snapshot();
+        next_snapshot = std::chrono::steady_clock::now() + snapshot_interval_;
+    }
+
+    spdlog::debug("Snapshot thread finished");
+}
+
+bool TradePatternDetector::save_context_snapshot() {
+    using SnapshotState = TradeProcessorImpl::ShardSnapshotState;
+
+    auto snapshot_time = std::chrono::system_clock::now();
+    std::vector<TradeRecord> records;
+
+    // Collect one shard at a time so at most one worker is copying its
+    // windows at any moment - the pause per shard is bounded by its live
+    // window volume, not the whole store
+    for (size_t i = 0; i < impl_->snapshot_states_.size(); ++i) {
+        auto& state = *impl_->snapshot_states_[i];
+        state.phase.store(SnapshotState::kRequested, std::memory_order_release);
+        impl_->worker_waits_[i]->notify();
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (state.phase.load(std::memory_order_acquire) != SnapshotState::kReady) {
+            if (!running_.load() || std::chrono::steady_clock::now() > deadline) {
+                state.phase.store(SnapshotState::kIdle, std::memory_order_release);
+                spdlog::warn("Context snapshot abandoned waiting on shard {}", i);
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        records.insert(records.end(), state.buffer.begin(), state.buffer.end());
+        state.buffer.clear();
+        state.phase.store(SnapshotState::kIdle, std::memory_order_release);
+    }
+
+    return ContextSnapshot::write(snapshot_path_, records, snapshot_time);
+}
+
+bool TradePatternDetector::load_context_snapshot() {
+    // Records older than the lookback window would expire on the first
+    // fresh trade anyway; skip them up front
+    auto cutoff = std::chrono::system_clock::now() - HistoricalContext{}.lookback_window;
+    size_t loaded = 0;
+    size_t skipped = 0;
+
+    bool ok = ContextSnapshot::load(snapshot_path_, [&](const TradeRecord& record) {
+        if (record.timestamp < cutoff ||
+            record.instrument_id == StringInterner::kInvalidId) {
+            ++skipped;
+            return;
+        }
+
+        // Same shard routing and keying as the live path, so each context
+        // lands exactly where its owning worker will look for it
+        size_t shard_index = record.instrument_id % worker_queues_.size();
+        uint64_t context_key = (static_cast<uint64_t>(record.instrument_id) << 32) |
+                               record.account_id;
+        impl_->context_shards_[shard_index]
+            ->get_or_create(context_key, record.timestamp)
+            .add_trade(record);
+        ++loaded;
+    });
+
+    if (ok) {
+        spdlog::info("Warm restart: {} window records restored, {} stale skipped",
+                     loaded, skipped);
+    }
+    return ok;
+}
+
+void TradePatternDetector::flush_heavy_batch(size_t worker_index) {
+    auto& batch = impl_->heavy_batches_[worker_index];
+    if (batch.empty()) {
+        return;
+    }
+
+    auto items = std::move(batch);
+    batch.clear();
+    batch.reserve(TradeProcessorImpl::kOffloadBatch);
+
+    impl_->offload_arena_.execute([this, &items] {
+        impl_->offload_group_.run([this, items = std::move(items)] {
+            // Heavy detectors see the scalar aggregates captured at enqueue
+            // time; they maintain their own cross-reference state and do
+            // not read the ring-buffer windows
+            HistoricalContext snapshot;
+            for (const auto& item : items) {
+                snapshot.avg_price = item.avg_price;
+                snapshot.avg_volume = item.avg_volume;
+                snapshot.price_volatility = item.price_volatility;
+                snapshot.account_total_volume = item.account_total_volume;
+
+                auto sink = [this, &item](const std::string& name,
+                                          SurveillanceAlert&& alert) {
+                    impl_->hot_logger_.log(impl_->site_alert_,
+                                           item.trade.instrument_id,
+                                           item.trade.account_id, name.c_str());
+                    alert.ingress_ns = item.trade.ingress_ns;
+                    enqueue_alert(std::move(alert));
+                    stat_shards_[item.shard_index]->alerts_generated.fetch_add(
+                        1, std::memory_order_relaxed);
+                };
+
                 try {
-                    auto alert_opt = detector->detect_pattern(trade, context);
-                    if (alert_opt) {
-                        alert_queue_.push(*alert_opt);
-                        alerts_generated_.fetch_add(1);
-                        
-                        spdlog::info("Alert generated by {}: {} for trade {}", 
-                                   name, alert_opt->title, trade.trade_id);
-                    }
+                    impl_->builtin_pipeline_->run_heavy(item.trade, snapshot, sink);
                 } catch (const std::exception& e) {
-                    spdlog::error("Error in pattern detector {}: {}", name, e.what());
+                    spdlog::error("Error in offloaded detector batch: {}", e.what());
                 }
             }
         });
+    });
 }
 
 void TradePatternDetector::initialize_builtin_detectors() {
-    // Register built-in pattern detectors
-    register_pattern_detector("pump_dump", 
-        std::make_shared<PumpDumpDetector>());
-    
-    register_pattern_detector("layering", 
-        std::make_shared<LayeringDetector>());
-    
-    register_pattern_detector("wash_trading", 
-        std::make_shared<WashTradingDetector>());
-    
-    register_pattern_detector("insider_trading", 
-        std::make_shared<InsiderTradingDetector>());
-    
-    register_pattern_detector("front_running", 
-        std::make_shared<FrontRunningDetector>());
-    
-    spdlog::info("Initialized {} built-in pattern detectors", detectors_.size());
+    // Built-ins live in the statically-dispatched pipeline rather than the
+    // shared_ptr registry; their detect_pattern() calls are direct and the
+    // detector set never changes mid-session
+    impl_->builtin_pipeline_ = std::make_unique<BuiltinDetectorPipeline>();
+
+    spdlog::info("Initialized static pipeline with {} built-in pattern detectors",
+                 BuiltinDetectorPipeline::size());
 }
 
 bool TradePatternDetector::load_configuration(const std::string& config_path) {
@@ -448,12 +1479,14 @@ bool TradePatternDetector::validate_trade_data(const TradeData& trade) const {
     
     // Additional validation rules
     if (trade.timestamp > std::chrono::system_clock::now()) {
-        spdlog::warn("Trade timestamp is in the future: {}", trade.trade_id);
+        impl_->hot_logger_.log(impl_->site_future_timestamp_, 0, 0,
+                               trade.trade_id.c_str());
         return false;
     }
-    
+
     if (trade.price <= 0.0 || trade.quantity == 0) {
-        spdlog::warn("Invalid price or quantity: {}", trade.trade_id);
+        impl_->hot_logger_.log(impl_->site_bad_values_, 0, 0,
+                               trade.trade_id.c_str());
         return false;
     }
     